@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright (C) 2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import logging as log
+import sys
+from time import perf_counter
+
+import numpy as np
+from openvino.runtime import Core, get_version, AsyncInferQueue, Tensor
+from openvino.runtime.utils.types import get_dtype
+
+
+def random_tensor(model_input):
+    dtype = get_dtype(model_input.element_type)
+    rand_min, rand_max = (0, 1) if dtype == bool else (np.iinfo(np.uint8).min, np.iinfo(np.uint8).max)
+    # np.random.uniform excludes high: add 1 to have it generated
+    if np.dtype(dtype).kind in ['i', 'u', 'b']:
+        rand_max += 1
+    rs = np.random.RandomState(np.random.MT19937(np.random.SeedSequence(0)))
+    if model_input.partial_shape.is_dynamic:
+        raise RuntimeError("Models with dynamic shapes aren't supported. Input tensors must have specific shapes before inference")
+    return Tensor(rs.uniform(rand_min, rand_max, list(model_input.shape)).astype(dtype))
+
+
+def run(compiled_model, inputs, mode, seconds_to_run):
+    # AsyncInferQueue creates optimal number of InferRequest instances
+    ireqs = AsyncInferQueue(compiled_model)
+    completed = [0]
+
+    def callback(request, userdata):
+        completed[0] += 1
+
+    ireqs.set_callback(callback, batched=mode != 'start_async')
+    # Every call of start_async_batch submits one job per request of the pool
+    batch = [inputs] * len(ireqs)
+    # Warm up
+    ireqs.start_async_batch(batch)
+    ireqs.wait_all()
+    completed[0] = 0
+    start = perf_counter()
+    time_point_to_finish = start + seconds_to_run
+    while perf_counter() < time_point_to_finish:
+        if mode == 'start_async_batch':
+            ireqs.start_async_batch(batch)
+        else:
+            for _ in batch:
+                ireqs.start_async(inputs)
+    ireqs.wait_all()
+    duration = perf_counter() - start
+    return completed[0], duration
+
+
+def main():
+    log.basicConfig(format='[ %(levelname)s ] %(message)s', level=log.INFO, stream=sys.stdout)
+    log.info('OpenVINO:')
+    log.info(f"{'Build ':.<39} {get_version()}")
+    if len(sys.argv) != 2:
+        log.info(f'Usage: {sys.argv[0]} <path_to_model>')
+        return 1
+    # Optimize for throughput. Best throughput can be reached by
+    # running multiple openvino.runtime.InferRequest instances asyncronously
+    tput = {'PERFORMANCE_HINT': 'THROUGHPUT'}
+
+    # Create Core and use it to compile a model.
+    # Pick a device by replacing CPU, for example MULTI:CPU(4),GPU(8).
+    core = Core()
+    compiled_model = core.compile_model(sys.argv[1], 'CPU', tput)
+    inputs = {model_input: random_tensor(model_input) for model_input in compiled_model.inputs}
+    # Benchmark each submission mode for seconds_to_run seconds
+    seconds_to_run = 10
+    for mode in ('start_async', 'start_async_batched_callback', 'start_async_batch'):
+        count, duration = run(compiled_model, inputs, mode, seconds_to_run)
+        # Report results
+        log.info(f'{mode}:')
+        log.info(f'    Count:      {count} iterations')
+        log.info(f'    Duration:   {duration * 1e3:.2f} ms')
+        log.info(f'    Throughput: {count / duration:.2f} FPS')
+
+
+if __name__ == '__main__':
+    main()
@@ -3,7 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from functools import singledispatch
-from typing import Any, Iterable, Union, Dict, Optional
+from typing import Any, Iterable, List, Union, Dict, Optional
 from pathlib import Path
 
 import numpy as np
@@ -18,6 +18,7 @@ from openvino._pyopenvino import Tensor
 from openvino.runtime.utils.data_helpers import (
     _InferRequestWrapper,
     _data_dispatch,
+    _data_dispatch_owned,
     tensor_from_file,
 )
 
@@ -342,6 +343,32 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    def start_async_batch(
+        self,
+        inputs: List[Any],
+        userdata: Optional[List[Any]] = None,
+    ) -> None:
+        """Run asynchronous inference of many jobs using the available InferRequests from the pool.
+
+        All of the jobs are submitted to the InferRequests under one release of the GIL,
+        the function returns when the last job is started.
+
+        Every item of the `inputs` is the data of one job, it accepts the same types
+        as `inputs` of `start_async`. Items which are not of `openvino.runtime.Tensor`
+        type are copied to the new Tensors before submission, so the data can be
+        modified after the call.
+
+        :param inputs: Data of the jobs, one item per job.
+        :type inputs: List[Any]
+        :param userdata: Data that will be passed to a callback, one item per job.
+        :type userdata: List[Any], optional
+        """
+        ports = super().__getitem__(0).model_inputs if len(self) > 0 else []
+        super().start_async_batch(
+            [_data_dispatch_owned(ports, job_inputs) for job_inputs in inputs],
+            userdata,
+        )
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -3,5 +3,6 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from openvino.runtime.utils.data_helpers.data_dispatcher import _data_dispatch
+from openvino.runtime.utils.data_helpers.data_dispatcher import _data_dispatch_owned
 from openvino.runtime.utils.data_helpers.wrappers import tensor_from_file
 from openvino.runtime.utils.data_helpers.wrappers import _InferRequestWrapper
@@ -3,7 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from functools import singledispatch
-from typing import Any, Dict, Union, Optional
+from typing import Any, Dict, List, Union, Optional
 
 import numpy as np
 
@@ -326,6 +326,72 @@ def _(
 ###
 
 
+###
+# Start of "owned" dispatcher.
+# (1) Tensors are kept "as-is", all other values are copied to the new Tensors.
+# (2) Element types are taken from the model inputs, so the (possibly busy) InferRequests are not accessed.
+###
+def get_port_type(
+    ports: List[ConstOutput],
+    key: Optional[ValidKeys] = None,
+) -> Type:
+    if key is None:
+        return ports[0].get_element_type()
+    elif isinstance(key, int):
+        return ports[key].get_element_type()
+    elif isinstance(key, ConstOutput):
+        return key.get_element_type()
+    elif isinstance(key, str):
+        for port in ports:
+            if key in port.get_names():
+                return port.get_element_type()
+        raise RuntimeError(f"Port for tensor name {key} was not found.")
+    else:
+        raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
+
+
+def value_to_owned_tensor(
+    value: Any,
+    ports: List[ConstOutput],
+    key: Optional[ValidKeys] = None,
+) -> Tensor:
+    if isinstance(value, Tensor):
+        return value
+    if isinstance(value, (np.number, int, float)):
+        return value_to_tensor(value)
+    if not isinstance(value, np.ndarray):
+        if not hasattr(value, "__array__"):
+            raise TypeError(f"Incompatible inputs of type: {type(value)} under {key} key!")
+        value = np.array(value, copy=False)
+    # If shape is "empty", assume this is a scalar value
+    if not value.shape:
+        return Tensor(np.ndarray([], value.dtype, np.array(value)))
+    tensor_type = get_port_type(ports, key)
+    if tensor_type.is_dynamic():
+        return Tensor(to_c_style(value), shared_memory=False)
+    tensor_dtype = tensor_type.to_dtype()
+    # WA for FP16-->BF16 edge-case
+    if tensor_type == Type.bf16:
+        tensor = Tensor(tensor_type, value.shape)
+        tensor.data[:] = value.view(tensor_dtype)
+        return tensor
+    return Tensor(to_c_style(value.astype(tensor_dtype, copy=False)), shared_memory=False)
+
+
+def _data_dispatch_owned(
+    ports: List[ConstOutput],
+    inputs: Union[ContainerTypes, Tensor, np.ndarray, ScalarTypes] = None,
+) -> Union[dict, Tensor]:
+    if inputs is None:
+        return {}
+    if isinstance(inputs, (dict, list, tuple)):
+        return {k: value_to_owned_tensor(v, ports, key=k) for k, v in normalize_arrays(inputs).items()}
+    return value_to_owned_tensor(inputs, ports)
+###
+# End of "owned" dispatcher methods.
+###
+
+
 def _data_dispatch(
     request: _InferRequestWrapper,
     inputs: Union[ContainerTypes, Tensor, np.ndarray, ScalarTypes] = None,
@@ -7,8 +7,10 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,13 +21,131 @@
 
 namespace py = pybind11;
 
-class AsyncInferQueue {
+// Bounded lock-free MPMC queue of the request handles (D. Vyukov's algorithm). Every handle is queued at most once,
+// so the capacity equal to the number of the requests is never exceeded.
+class HandlesRing {
 public:
-    AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
-        if (jobs == 0) {
-            jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
+    explicit HandlesRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(size_t handle) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.handle = handle;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return;
+                }
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
         }
+    }
+
+    bool try_pop(size_t& handle) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos + 1) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    handle = cell.handle;
+                    cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < pos + 1) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool empty() const {
+        const size_t pos = m_head.load(std::memory_order_relaxed);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        size_t handle = 0;
+    };
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};
+};
+
+// Inputs of one job of the batch. They are converted from Python objects while the GIL is held,
+// so they can be set to a request without the GIL.
+struct JobInputs {
+    std::vector<std::pair<ov::Output<const ov::Node>, ov::Tensor>> ports;
+    std::vector<std::pair<std::string, ov::Tensor>> names;
+    std::vector<std::pair<size_t, ov::Tensor>> indices;
+    ov::Tensor single;  // for the models with one input
+
+    explicit JobInputs(const py::handle& inputs) {
+        if (inputs.is_none()) {
+            return;
+        } else if (py::isinstance<ov::Tensor>(inputs)) {
+            single = Common::cast_to_tensor(inputs);
+        } else if (py::isinstance<py::dict>(inputs)) {
+            for (auto&& input : inputs.cast<py::dict>()) {
+                auto tensor = Common::cast_to_tensor(input.second);
+                if (py::isinstance<ov::Output<const ov::Node>>(input.first)) {
+                    ports.emplace_back(input.first.cast<ov::Output<const ov::Node>>(), tensor);
+                } else if (py::isinstance<py::str>(input.first)) {
+                    names.emplace_back(input.first.cast<std::string>(), tensor);
+                } else if (py::isinstance<py::int_>(input.first)) {
+                    indices.emplace_back(input.first.cast<size_t>(), tensor);
+                } else {
+                    throw py::type_error("Incompatible key type for tensor named: " +
+                                         input.first.cast<std::string>());
+                }
+            }
+        } else {
+            throw py::type_error("Incompatible inputs of type: " + std::string(inputs.get_type().str()));
+        }
+    }
+
+    void set_to(ov::InferRequest& request) const {
+        if (single) {
+            request.set_input_tensor(single);
+        }
+        for (auto&& input : ports) {
+            request.set_tensor(input.first, input.second);
+        }
+        for (auto&& input : names) {
+            request.set_tensor(input.first, input.second);
+        }
+        for (auto&& input : indices) {
+            request.set_input_tensor(input.first, input.second);
+        }
+    }
+};
 
+class AsyncInferQueue {
+public:
+    AsyncInferQueue(ov::CompiledModel& model, size_t jobs)
+        : AsyncInferQueue(model,
+                          jobs ? jobs : static_cast<size_t>(Common::get_optimal_number_of_requests(model)),
+                          true) {}
+
+    AsyncInferQueue(ov::CompiledModel& model, size_t jobs, bool /* jobs number is resolved */)
+        : m_idle_handles(jobs), m_completed_handles(jobs) {
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
 
@@ -45,59 +165,104 @@ public:
     }
 
     bool _is_ready() {
+        // Run the callbacks of the completed requests, it makes them idle
+        deliver_completed();
         // Check if any request has finished already
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
+        // acquire the mutex to access m_errors and the reserved handle
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
-        return !(m_idle_handles.empty());
+        return m_has_reserved_handle || !m_idle_handles.empty();
     }
 
     size_t get_idle_request_id() {
+        deliver_completed();
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
+        size_t idle_handle = reserve_idle_handle();
         // wait for request to make sure it returned from callback
         m_requests[idle_handle].m_request.wait();
+        // acquire the mutex to access m_errors
+        std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
         return idle_handle;
     }
 
+    // Takes the handle returned by get_idle_request_id, it is not idle anymore
+    size_t pop_idle_request_id() {
+        const auto handle = get_idle_request_id();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_has_reserved_handle = false;
+        return handle;
+    }
+
     void wait_all() {
         // Wait for all request to complete
         // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        for (auto&& request : m_requests) {
-            request.m_request.wait();
+        {
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
         }
+        // the callbacks of the last completed requests are not delivered yet
+        deliver_completed();
         // acquire the mutex to access m_errors
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
 
+    void start_async_batch(const std::vector<JobInputs>& jobs, std::vector<py::object>& user_ids) {
+        deliver_completed();
+        {
+            // All the jobs are submitted under one GIL release
+            py::gil_scoped_release release;
+            for (size_t job = 0; job < jobs.size(); job++) {
+                const auto handle = reserve_idle_handle();
+                m_requests[handle].m_request.wait();
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_errors.size() > 0)
+                        break;
+                    m_has_reserved_handle = false;
+                }
+                // The handle is idle, so its user ID is not used by callbacks. Swapping the objects only exchanges
+                // the pointers without touching the reference counters, so it is safe without the GIL.
+                // The previous user ID is released with the user_ids when the GIL is acquired again.
+                std::swap(m_user_ids[handle], user_ids[job]);
+                try {
+                    jobs[job].set_to(m_requests[handle].m_request);
+                    *m_requests[handle].m_start_time = Time::now();
+                    m_requests[handle].m_request.start_async();
+                } catch (...) {
+                    // the request is not started, so return it to the pool
+                    std::swap(m_user_ids[handle], user_ids[job]);
+                    m_idle_handles.push(handle);
+                    notify_waiters();
+                    throw;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_errors.size() > 0)
+            throw m_errors.front();
+    }
+
     void set_default_callbacks() {
+        m_batched_callback = py::none();
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
             m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
+                // Add idle handle to queue
+                m_idle_handles.push(handle);
                 // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                notify_waiters();
 
                 try {
                     if (exception_ptr) {
@@ -110,7 +275,14 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batched) {
+        // the requests completed with the previous batched callback are not idle yet
+        deliver_completed();
+        if (batched) {
+            set_batched_callbacks(f_callback);
+            return;
+        }
+        m_batched_callback = py::none();
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -131,14 +303,36 @@ public:
                     }
                 }
 
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
+                // Add idle handle to queue
+                m_idle_handles.push(handle);
+                // Notify locks in getIdleRequestId()
+                notify_waiters();
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    throw ov::Exception(e.what());
+                }
+            });
+        }
+    }
+
+    // The completed requests are collected in the ring without the GIL, the Python callback is called for all of
+    // them at once on the Python thread which calls into the queue next time.
+    void set_batched_callbacks(py::function f_callback) {
+        m_batched_callback = f_callback;
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                // The callback is not called for the failed requests
+                if (exception_ptr) {
                     m_idle_handles.push(handle);
+                } else {
+                    m_completed_handles.push(handle);
                 }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                notify_waiters();
 
                 try {
                     if (exception_ptr) {
@@ -151,13 +345,81 @@ public:
         }
     }
 
+    // Calls the batched callback for the completed requests and makes them idle, the GIL must be held
+    void deliver_completed() {
+        if (m_batched_callback.is_none()) {
+            return;
+        }
+        bool delivered = false;
+        size_t handle;
+        while (m_completed_handles.try_pop(handle)) {
+            try {
+                m_batched_callback(m_requests[handle], m_user_ids[handle]);
+            } catch (const py::error_already_set& py_error) {
+                assert(py_error.type());
+                // acquire the mutex to access m_errors
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_errors.push(py_error);
+            }
+            m_idle_handles.push(handle);
+            delivered = true;
+        }
+        if (delivered) {
+            notify_waiters();
+        }
+    }
+
+    // Waits for an idle request without the GIL and reserves it until pop_idle_request_id is called,
+    // so the repeated calls return the same handle
+    size_t reserve_idle_handle() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_has_reserved_handle) {
+            if (m_idle_handles.try_pop(m_reserved_handle)) {
+                m_has_reserved_handle = true;
+                break;
+            }
+            if (!m_completed_handles.empty()) {
+                // the completed requests become idle when their callbacks are delivered
+                lock.unlock();
+                {
+                    py::gil_scoped_acquire acquire;
+                    deliver_completed();
+                }
+                lock.lock();
+                continue;
+            }
+            m_waiters++;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_cv.wait(lock, [this] {
+                return !m_idle_handles.empty() || !m_completed_handles.empty();
+            });
+            m_waiters--;
+        }
+        return m_reserved_handle;
+    }
+
+    // The completion path doesn't take the mutex unless somebody waits for an idle request
+    void notify_waiters() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load() > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
+    HandlesRing m_idle_handles;
+    // requests which batched callbacks are not delivered yet
+    HandlesRing m_completed_handles;
+    size_t m_reserved_handle = 0;
+    bool m_has_reserved_handle = false;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
+    py::object m_batched_callback = py::none();
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    std::atomic<size_t> m_waiters{0};
     std::queue<py::error_already_set> m_errors;
 };
 
@@ -186,11 +448,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const ov::Tensor& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -232,11 +490,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -266,6 +520,46 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def(
+        "start_async_batch",
+        [](AsyncInferQueue& self, const py::list& inputs, const py::object& userdata) {
+            std::vector<py::object> user_ids(inputs.size(), py::none());
+            if (!userdata.is_none()) {
+                const auto userdata_list = userdata.cast<py::list>();
+                if (userdata_list.size() != inputs.size()) {
+                    throw py::value_error("The number of userdata items (" + std::to_string(userdata_list.size()) +
+                                          ") doesn't match the number of inputs (" + std::to_string(inputs.size()) +
+                                          ").");
+                }
+                for (size_t i = 0; i < user_ids.size(); i++) {
+                    user_ids[i] = userdata_list[i];
+                }
+            }
+            // Convert all of the inputs while the GIL is held, the jobs are submitted without it
+            std::vector<JobInputs> jobs;
+            jobs.reserve(inputs.size());
+            for (auto&& job_inputs : inputs) {
+                jobs.emplace_back(job_inputs);
+            }
+            self.start_async_batch(jobs, user_ids);
+        },
+        py::arg("inputs"),
+        py::arg("userdata") = py::none(),
+        R"(
+            Run asynchronous inference of many jobs using the available InferRequests.
+
+            All of the jobs are submitted under one release of the GIL, the function
+            returns when the last job is started.
+
+            :param inputs: Data to set on input tensors of the InferRequests, one item per job.
+            Items are either openvino.runtime.Tensor for the models with single input or
+            dicts of the same format as in start_async.
+            :type inputs: list[Union[openvino.runtime.Tensor, dict[Union[int, str, openvino.runtime.ConstOutput] : openvino.runtime.Tensor]]]
+            :param userdata: Data that will be passed to a callback, one item per job.
+            :type userdata: Optional[list[Any]]
+            :rtype: None
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -300,6 +594,8 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
+            py::arg("callback"),
+            py::arg("batched") = false,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -314,8 +610,15 @@ void regclass_AsyncInferQueue(py::module m) {
 
                 async_infer_queue.set_callback(f)
 
+            If batched is True, the callback isn't called from the inference threads.
+            Completed requests are collected without acquiring the GIL and the callback
+            is called for all of them by the next call of start_async, start_async_batch,
+            get_idle_request_id, is_ready or wait_all.
+
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batched: Deliver the completions to the callback in batches. Default: False
+            :type batched: bool
         )");
 
     cls.def(
@@ -629,6 +629,75 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("batched", [False, True])
+def test_infer_queue_start_async_batch(device, batched):
+    jobs = 16
+    param = ops.parameter([10], dtype=np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback, batched=batched)
+    inputs = [np.full([10], i - jobs // 2, dtype=np.float64) for i in range(jobs)]
+    infer_queue.start_async_batch(inputs, list(range(jobs)))
+    # the data is copied, so it can be modified after the submission
+    for job_inputs in inputs:
+        job_inputs.fill(-1)
+    infer_queue.wait_all()
+
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.full([10], max(i - jobs // 2, 0), dtype=np.float32))
+
+
+def test_infer_queue_start_async_batch_mixed_inputs(device):
+    core = Core()
+    param = ops.parameter([10], dtype=np.float32, name="data")
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    results = {}
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback, batched=True)
+    data = np.arange(-5, 5, dtype=np.float32)
+    infer_queue.start_async_batch([Tensor(data), {"data": data}, {0: data}, [data], data], ["a", "b", "c", "d", "e"])
+    infer_queue.start_async_batch([data])
+    infer_queue.wait_all()
+
+    assert sorted(results.keys(), key=str) == sorted(["a", "b", "c", "d", "e", None], key=str)
+    for result in results.values():
+        assert np.array_equal(result, np.maximum(data, 0))
+
+    with pytest.raises(ValueError) as e:
+        infer_queue.start_async_batch([data, data], ["a"])
+    assert "doesn't match the number of inputs" in str(e.value)
+
+
+def test_infer_queue_batched_callback_fail(device):
+    param = ops.parameter([10], dtype=np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(request, _):
+        raise ValueError("Error in batched callback")
+
+    infer_queue.set_callback(callback, batched=True)
+    with pytest.raises(ValueError) as e:
+        infer_queue.start_async_batch([np.ones([10], dtype=np.float32)] * 4)
+        infer_queue.wait_all()
+
+    assert "Error in batched callback" in str(e.value)
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
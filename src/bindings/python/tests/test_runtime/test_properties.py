@@ -188,6 +188,7 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (properties.auto_batch_partial_batches, "AUTO_BATCH_PARTIAL_BATCHES", ((True, True),)),
         (
             properties.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -207,6 +208,8 @@ def test_properties_ro(ov_property_ro, expected_value):
             ((properties.Affinity.NONE, properties.Affinity.NONE),),
         ),
         (properties.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True),)),
+        (properties.enable_mmap, "ENABLE_MMAP", ((True, True),)),
+        (properties.enable_compilation_profile, "ENABLE_COMPILATION_PROFILE", ((True, True),)),
         (properties.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (properties.hint.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (
@@ -30,8 +30,19 @@ public:
      */
     Hash(uint64_t& output_hash_value);
 
+    /**
+     * @brief Hash pass constructor
+     *
+     * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
+     * will be set to this variable
+     * @param hash_constants_data If false, the data of Constant nodes is not hashed (their types and shapes still are),
+     * so the caller can hash the data in a more efficient way
+     */
+    Hash(uint64_t& output_hash_value, bool hash_constants_data);
+
 private:
     uint64_t& m_hash;
+    bool m_hash_constants_data = true;
 };
 
 }  // namespace pass
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief A file mapped to the memory. The mapping is private and writable: the file content is never modified,
+ * the written pages become private copies (copy-on-write). The file is unmapped when the object is destroyed.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file to the memory
+ * @param path Path to the file
+ * @return The mapped memory, throws std::runtime_error if the file can't be mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file with the wide char path to the memory
+ * @param path Path to the file
+ * @return The mapped memory, throws std::runtime_error if the file can't be mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
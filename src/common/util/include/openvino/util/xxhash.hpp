@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Calculates the XXH64 hash (https://github.com/Cyan4973/xxHash) of the buffer.
+ * The buffer is processed by 32 bytes in four independent lanes, so the hash runs close to the memory bandwidth.
+ * @param data Pointer to the buffer, may be unaligned
+ * @param size Size of the buffer in bytes
+ * @param seed Seed of the hash
+ * @return 64-bit hash value
+ */
+uint64_t xxh64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+template <typename T>
+inline T load(const uint8_t* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(value));  // unaligned load
+    return value;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * prime1 + prime4;
+}
+
+}  // namespace
+
+uint64_t ov::util::xxh64(const void* buffer, size_t size, uint64_t seed) {
+    const uint8_t* data = static_cast<const uint8_t*>(buffer);
+    const uint8_t* const end = data + size;
+    uint64_t h64;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+
+        do {
+            v1 = xxh_round(v1, load<uint64_t>(data));
+            v2 = xxh_round(v2, load<uint64_t>(data + 8));
+            v3 = xxh_round(v3, load<uint64_t>(data + 16));
+            v4 = xxh_round(v4, load<uint64_t>(data + 24));
+            data += 32;
+        } while (data <= limit);
+
+        h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h64 = merge_round(h64, v1);
+        h64 = merge_round(h64, v2);
+        h64 = merge_round(h64, v3);
+        h64 = merge_round(h64, v4);
+    } else {
+        h64 = seed + prime5;
+    }
+
+    h64 += static_cast<uint64_t>(size);
+
+    for (; data + 8 <= end; data += 8) {
+        h64 ^= xxh_round(0, load<uint64_t>(data));
+        h64 = rotl(h64, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(load<uint32_t>(data)) * prime1;
+        h64 = rotl(h64, 23) * prime2 + prime3;
+        data += 4;
+    }
+    for (; data < end; ++data) {
+        h64 ^= (*data) * prime5;
+        h64 = rotl(h64, 11) * prime1;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
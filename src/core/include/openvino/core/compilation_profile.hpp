@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/// \brief ov::CompilationProfile is a structured report of the time spent in the stages of a model compilation:
+/// frontend conversion, transformation passes, plugin graph initialization, primitive creation, weights reorders.
+///
+/// The profile collects the records of the threads it is activated on with CompilationProfile::Scope. The stages
+/// are timed with CompilationProfile::Stage, which does nothing (except for a thread local check) when no profile is
+/// active, so the instrumented code doesn't need to be rebuilt to get the report.
+///
+/// The profile of a compiled model can be requested with the `ov::enable_compilation_profile` compile_model property
+/// and read back with the `ov::compilation_profile` compiled model property.
+/// \ingroup ov_model_cpp_api
+class OPENVINO_API CompilationProfile {
+public:
+    /// \brief A timed stage
+    struct Record {
+        /// \brief Kind of the stage: "frontend", "transformation", "graph_init", "primitive_creation",
+        /// "weights_reorder", ...
+        std::string stage;
+        /// \brief Name of the model, the transformation pass or the node the stage processed
+        std::string name;
+        /// \brief Number of the enclosing stages running on the same thread
+        size_t depth = 0;
+        /// \brief Start of the stage in microseconds since the profile creation
+        uint64_t start_us = 0;
+        uint64_t duration_us = 0;
+        /// \brief Number of the nodes rewritten by each matcher run inside the stage (the nested stages excluded)
+        std::map<std::string, uint64_t> matcher_hits;
+    };
+
+    /// \brief Activates the profile on the current thread for the lifetime of the scope. The previously active
+    /// profile is restored on destruction, so the scopes can be nested.
+    class OPENVINO_API Scope {
+    public:
+        explicit Scope(std::shared_ptr<CompilationProfile> profile);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::shared_ptr<CompilationProfile> m_previous;
+    };
+
+    /// \brief Times the code from construction till destruction and adds the record to the profile active on the
+    /// current thread. If there is no active profile the stage does nothing.
+    class OPENVINO_API Stage {
+    public:
+        explicit Stage(const char* stage, const std::string& name = {});
+        ~Stage();
+
+        Stage(const Stage&) = delete;
+        Stage& operator=(const Stage&) = delete;
+
+        /// \brief Returns true if the stage is recorded. Allows to skip the computation of the stage name when the
+        /// profiling is off.
+        bool is_active() const {
+            return m_profile != nullptr;
+        }
+
+        void set_name(const std::string& name);
+
+        /// \brief Counts a successful rewrite of the given matcher in the innermost stage of the current thread
+        static void add_matcher_hit(const std::string& matcher_name);
+
+    private:
+        std::shared_ptr<CompilationProfile> m_profile;
+        Record m_record;
+        std::chrono::steady_clock::time_point m_start;
+        Stage* m_parent = nullptr;
+    };
+
+    CompilationProfile();
+    CompilationProfile(const CompilationProfile& other);
+    CompilationProfile& operator=(const CompilationProfile& other);
+
+    /// \brief Returns the profile active on the current thread or nullptr
+    static std::shared_ptr<CompilationProfile> get_current();
+
+    /// \brief Adds a record, it is safe to call from several threads
+    void add_record(Record record);
+
+    /// \brief Returns the records ordered by their start time
+    std::vector<Record> get_records() const;
+
+    /// \brief Returns the total duration in microseconds of the records of the given stage kind on the given depth
+    uint64_t get_total_duration(const std::string& stage, size_t depth = 0) const;
+
+    /// \brief Dumps the records to JSON:
+    /// `{"records": [{"stage": ..., "name": ..., "depth": ..., "start_us": ..., "duration_us": ...,
+    /// "matcher_hits": {...}}, ...]}`
+    std::string to_json() const;
+
+    std::chrono::steady_clock::time_point get_start_time() const {
+        return m_start;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+};
+
+OPENVINO_API
+std::ostream& operator<<(std::ostream& out, const CompilationProfile& profile);
+
+}  // namespace ov
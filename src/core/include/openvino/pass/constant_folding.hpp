@@ -19,6 +19,15 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    ConstantFolding() = default;
+    /**
+     * @brief Creates the pass which folds the independent nodes concurrently and runs the reference
+     *        kernels of the heavy operations (Convert, elementwise, Transpose, Gather, Concat) in parallel.
+     *        The result is the same as of the sequential folding.
+     * @param num_threads  Maximal number of threads, 0 means the number of hardware threads,
+     *                     1 means the sequential folding.
+     */
+    explicit ConstantFolding(size_t num_threads);
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +35,15 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+
+private:
+    /// \brief Replaces the node outputs with the folded values, returns true if any output is replaced.
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+    /// \brief Processes the nodes level by level, the nodes of one level don't depend on each other,
+    /// so they are evaluated concurrently, while the graph is modified sequentially.
+    bool fold_by_levels(const std::shared_ptr<ov::Model>& model, bool rewritten);
+
+    size_t m_num_threads = 1;
 };
 
 /**
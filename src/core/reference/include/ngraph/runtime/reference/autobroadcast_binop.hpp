@@ -10,11 +10,21 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+template <typename T, typename U, typename Functor>
+void autobroadcast_binop(const T* arg0,
+                         const T* arg1,
+                         U* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         const op::AutoBroadcastSpec& broadcast_spec,
+                         Functor elementwise_functor);
+
 namespace internal {
 inline void row_major_strides(const Shape& shape, size_t* strides, size_t size) noexcept {
     size_t* st = strides + size - 1;
@@ -70,6 +80,50 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
+
+/// \brief Splits the numpy broadcasted binop over the outermost output dimension, each thread processes the slices
+///        of the rank reduced by one. Returns false if the shapes are not worth splitting.
+template <typename T, typename U, typename Functor>
+bool numpy_autobroadcast_binop_parallel(const T* arg0,
+                                        const T* arg1,
+                                        U* out,
+                                        const Shape& arg0_shape,
+                                        const Shape& arg1_shape,
+                                        Functor elementwise_functor) {
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    if (get_parallel_threads() <= 1 || rank < 2) {
+        return false;
+    }
+    Shape shape0(rank - arg0_shape.size(), 1), shape1(rank - arg1_shape.size(), 1);
+    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+    const Shape slice_shape0(shape0.begin() + 1, shape0.end());
+    const Shape slice_shape1(shape1.begin() + 1, shape1.end());
+    size_t out_slice_size = 1;
+    for (size_t i = 1; i < rank; ++i) {
+        out_slice_size *= std::max(shape0[i], shape1[i]);
+    }
+    const size_t slices = std::max(shape0[0], shape1[0]);
+    if (slices < 2 || out_slice_size == 0 || slices * out_slice_size < parallel_min_elements) {
+        return false;
+    }
+    const size_t step0 = shape0[0] == 1 ? 0 : shape_size(slice_shape0);
+    const size_t step1 = shape1[0] == 1 ? 0 : shape_size(slice_shape1);
+    const op::AutoBroadcastSpec numpy(op::AutoBroadcastType::NUMPY);
+    parallel_for(slices, parallel_min_elements / out_slice_size + 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            autobroadcast_binop(arg0 + i * step0,
+                                arg1 + i * step1,
+                                out + i * out_slice_size,
+                                slice_shape0,
+                                slice_shape1,
+                                numpy,
+                                elementwise_functor);
+        }
+    });
+    return true;
+}
 }  // namespace internal
 
 /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -99,9 +153,11 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        parallel_for(shape_size(arg0_shape), parallel_min_elements, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -128,6 +184,11 @@ void autobroadcast_binop(const T* arg0,
         {
             using namespace internal;
 
+            if (arg0_shape != arg1_shape &&
+                numpy_autobroadcast_binop_parallel(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor)) {
+                break;
+            }
+
             size_t const shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
 
             // TODO: Use compiler-specific alloca() or variable-length array
@@ -157,8 +218,10 @@ void autobroadcast_binop(const T* arg0,
             }
 
             if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                parallel_for(strides0[0], parallel_min_elements, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                });
             } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides0);
 
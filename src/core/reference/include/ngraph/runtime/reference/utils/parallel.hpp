@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief The minimal number of elements worth processing in a separate thread.
+constexpr size_t parallel_min_elements = 32 * 1024;
+
+/// \brief Returns the number of threads the reference kernels are allowed to use on the calling thread.
+///        It is 1 (sequential execution) unless it is changed by the ParallelScope.
+size_t get_parallel_threads();
+
+/// \brief Allows the reference kernels called on the current thread to use the given number of threads while the
+///        scope is alive. The setting is thread local, so the callers which don't open the scope are not affected.
+class ParallelScope {
+public:
+    explicit ParallelScope(size_t num_threads);
+    ~ParallelScope();
+
+    ParallelScope(const ParallelScope&) = delete;
+    ParallelScope& operator=(const ParallelScope&) = delete;
+
+private:
+    size_t m_prev_threads;
+};
+
+/// \brief Runs func(ithr, nthr) on nthr threads, the calling thread is used as the last one. The kernels called from
+///        the func run sequentially unless the func opens its own ParallelScope.
+///        The first exception thrown by the func is rethrown after all the threads are finished.
+template <typename F>
+void parallel_nt(size_t nthr, const F& func) {
+    if (nthr <= 1) {
+        func(0, 1);
+        return;
+    }
+    std::vector<std::exception_ptr> exceptions(nthr);
+    std::vector<std::thread> threads;
+    threads.reserve(nthr - 1);
+    for (size_t ithr = 0; ithr + 1 < nthr; ++ithr) {
+        threads.emplace_back([&func, &exceptions, ithr, nthr] {
+            try {
+                func(ithr, nthr);
+            } catch (...) {
+                exceptions[ithr] = std::current_exception();
+            }
+        });
+    }
+    try {
+        ParallelScope sequential(1);
+        func(nthr - 1, nthr);
+    } catch (...) {
+        exceptions[nthr - 1] = std::current_exception();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+/// \brief Splits [0, work_amount) into contiguous chunks of at least min_chunk items and runs func(begin, end) for
+///        each of them on up to get_parallel_threads() threads. Runs func(0, work_amount) on the calling thread if the
+///        work is too small to be split.
+template <typename F>
+void parallel_for(size_t work_amount, size_t min_chunk, const F& func) {
+    if (work_amount == 0) {
+        return;
+    }
+    const size_t nthr = std::min(get_parallel_threads(), work_amount / std::max<size_t>(min_chunk, 1));
+    if (nthr <= 1) {
+        func(0, work_amount);
+        return;
+    }
+    parallel_nt(nthr, [&](size_t ithr, size_t nthreads) {
+        const size_t chunk = work_amount / nthreads;
+        const size_t remainder = work_amount % nthreads;
+        const size_t begin = ithr * chunk + std::min(ithr, remainder);
+        const size_t end = begin + chunk + (ithr < remainder ? 1 : 0);
+        func(begin, end);
+    });
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -31,19 +33,32 @@ void concat(const std::vector<const char*>& args,
         steps *= out_shape[i];
     }
 
+    if (steps == 0 || args.empty()) {
+        return;
+    }
     const auto& shape_sizes = calculate_shape_sizes(in_shapes);
 
-    size_t out_offset = 0;
-    for (size_t step = 0; step < steps; ++step) {
-        for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+    // offsets of the inputs within one step of the output
+    std::vector<size_t> step_offsets(args.size() + 1, 0);
+    for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+        step_offsets[in_index + 1] = step_offsets[in_index] + shape_sizes[in_index] / steps;
+    }
+    const size_t step_size = step_offsets.back();
+    // the work item copies step_size / args.size() elements on average
+    const size_t min_chunk = parallel_min_elements * args.size() / std::max<size_t>(step_size, 1) + 1;
+
+    // each (step, input) pair is an independent copy, so they are split between the threads
+    parallel_for(steps * args.size(), min_chunk, [&](size_t begin, size_t end) {
+        for (size_t work = begin; work < end; ++work) {
+            const size_t step = work / args.size();
+            const size_t in_index = work % args.size();
             const size_t size = shape_sizes[in_index] / steps;
             const size_t in_offset = step * size;
+            const size_t out_offset = step * step_size + step_offsets[in_index];
 
             std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
-
-            out_offset += size;
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
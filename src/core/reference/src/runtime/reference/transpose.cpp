@@ -6,15 +6,73 @@
 
 #include <cfenv>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+// Each thread processes the range of the output rows (the innermost output dimension), the input offset is
+// advanced incrementally with the input strides permuted to the output order.
+void transpose_parallel(const char* data,
+                        char* out,
+                        const Shape& data_shape,
+                        size_t element_size,
+                        const std::vector<size_t>& axis_vector) {
+    const size_t rank = data_shape.size();
+    std::vector<size_t> in_strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; --i) {
+        in_strides[i - 1] = in_strides[i] * data_shape[i];
+    }
+    Shape shape(rank);
+    std::vector<size_t> strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        shape[i] = data_shape[axis_vector[i]];
+        strides[i] = in_strides[axis_vector[i]];
+    }
+
+    const size_t row_size = shape.back();
+    const size_t row_stride = strides.back();
+    const size_t rows = shape_size(data_shape) / row_size;
+    parallel_for(rows, parallel_min_elements / row_size + 1, [&](size_t begin, size_t end) {
+        std::vector<size_t> coord(rank - 1);
+        size_t in_offset = 0;
+        for (size_t i = rank - 1, row = begin; i > 0; --i) {
+            coord[i - 1] = row % shape[i - 1];
+            row /= shape[i - 1];
+            in_offset += coord[i - 1] * strides[i - 1];
+        }
+        char* dst = out + begin * row_size * element_size;
+        for (size_t row = begin; row < end; ++row) {
+            const char* src = data + in_offset * element_size;
+            if (row_stride == 1) {
+                std::memcpy(dst, src, row_size * element_size);
+                dst += row_size * element_size;
+            } else {
+                for (size_t j = 0; j < row_size; ++j) {
+                    std::memcpy(dst, src + j * row_stride * element_size, element_size);
+                    dst += element_size;
+                }
+            }
+            for (size_t i = rank - 1; i > 0; --i) {
+                in_offset += strides[i - 1];
+                if (++coord[i - 1] < shape[i - 1]) {
+                    break;
+                }
+                in_offset -= strides[i - 1] * shape[i - 1];
+                coord[i - 1] = 0;
+            }
+        }
+    });
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
@@ -24,6 +82,10 @@ void transpose(const char* data,
     // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
     std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
+    if (get_parallel_threads() > 1 && data_shape.size() > 1 && shape_size(data_shape) >= parallel_min_elements) {
+        transpose_parallel(data, out, data_shape, element_size, axis_vector);
+        return;
+    }
     runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
 }
 }  // namespace reference
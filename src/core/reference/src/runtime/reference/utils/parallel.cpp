@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+thread_local size_t parallel_threads = 1;
+}  // namespace
+
+size_t get_parallel_threads() {
+    return parallel_threads;
+}
+
+ParallelScope::ParallelScope(size_t num_threads) : m_prev_threads(parallel_threads) {
+    parallel_threads = std::max<size_t>(num_threads, 1);
+}
+
+ParallelScope::~ParallelScope() {
+    parallel_threads = m_prev_threads;
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compilation_profile.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace ov {
+
+namespace {
+struct ThreadProfilingState {
+    std::shared_ptr<CompilationProfile> profile;
+    CompilationProfile::Stage* innermost_stage = nullptr;
+};
+
+ThreadProfilingState& thread_state() {
+    static thread_local ThreadProfilingState state;
+    return state;
+}
+
+uint64_t to_us(std::chrono::steady_clock::duration duration) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+void write_json_string(std::ostream& out, const std::string& str) {
+    out << '"';
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                    << std::setfill(' ');
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+}  // namespace
+
+CompilationProfile::Scope::Scope(std::shared_ptr<CompilationProfile> profile)
+    : m_previous(std::move(thread_state().profile)) {
+    thread_state().profile = std::move(profile);
+}
+
+CompilationProfile::Scope::~Scope() {
+    thread_state().profile = std::move(m_previous);
+}
+
+CompilationProfile::Stage::Stage(const char* stage, const std::string& name) {
+    auto& state = thread_state();
+    if (!state.profile)
+        return;
+    m_profile = state.profile;
+    m_parent = state.innermost_stage;
+    m_record.stage = stage;
+    m_record.name = name;
+    m_record.depth = m_parent ? m_parent->m_record.depth + 1 : 0;
+    state.innermost_stage = this;
+    m_start = std::chrono::steady_clock::now();
+}
+
+CompilationProfile::Stage::~Stage() {
+    if (!m_profile)
+        return;
+    const auto end = std::chrono::steady_clock::now();
+    thread_state().innermost_stage = m_parent;
+    m_record.start_us = m_start > m_profile->get_start_time() ? to_us(m_start - m_profile->get_start_time()) : 0;
+    m_record.duration_us = to_us(end - m_start);
+    m_profile->add_record(std::move(m_record));
+}
+
+void CompilationProfile::Stage::set_name(const std::string& name) {
+    m_record.name = name;
+}
+
+void CompilationProfile::Stage::add_matcher_hit(const std::string& matcher_name) {
+    if (auto stage = thread_state().innermost_stage) {
+        ++stage->m_record.matcher_hits[matcher_name];
+    }
+}
+
+CompilationProfile::CompilationProfile() : m_start(std::chrono::steady_clock::now()) {}
+
+CompilationProfile::CompilationProfile(const CompilationProfile& other) : m_start(other.m_start) {
+    std::lock_guard<std::mutex> lock(other.m_mutex);
+    m_records = other.m_records;
+}
+
+CompilationProfile& CompilationProfile::operator=(const CompilationProfile& other) {
+    if (this != &other) {
+        auto records = other.get_records();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_start = other.m_start;
+        m_records = std::move(records);
+    }
+    return *this;
+}
+
+std::shared_ptr<CompilationProfile> CompilationProfile::get_current() {
+    return thread_state().profile;
+}
+
+void CompilationProfile::add_record(Record record) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.emplace_back(std::move(record));
+}
+
+std::vector<CompilationProfile::Record> CompilationProfile::get_records() const {
+    std::vector<Record> records;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        records = m_records;
+    }
+    // the stages are recorded when they finish, so the enclosing stage goes after the nested ones
+    std::stable_sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+        return lhs.start_us < rhs.start_us || (lhs.start_us == rhs.start_us && lhs.depth < rhs.depth);
+    });
+    return records;
+}
+
+uint64_t CompilationProfile::get_total_duration(const std::string& stage, size_t depth) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t total = 0;
+    for (const auto& record : m_records) {
+        if (record.stage == stage && record.depth == depth)
+            total += record.duration_us;
+    }
+    return total;
+}
+
+std::string CompilationProfile::to_json() const {
+    std::ostringstream out;
+    out << "{\"records\": [";
+    bool first_record = true;
+    for (const auto& record : get_records()) {
+        out << (first_record ? "\n  " : ",\n  ");
+        first_record = false;
+        out << "{\"stage\": ";
+        write_json_string(out, record.stage);
+        out << ", \"name\": ";
+        write_json_string(out, record.name);
+        out << ", \"depth\": " << record.depth << ", \"start_us\": " << record.start_us
+            << ", \"duration_us\": " << record.duration_us << ", \"matcher_hits\": {";
+        bool first_hit = true;
+        for (const auto& hit : record.matcher_hits) {
+            out << (first_hit ? "" : ", ");
+            first_hit = false;
+            write_json_string(out, hit.first);
+            out << ": " << hit.second;
+        }
+        out << "}}";
+    }
+    out << (first_record ? "]}" : "\n]}");
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const CompilationProfile& profile) {
+    return out << profile.to_json();
+}
+
+}  // namespace ov
@@ -11,6 +11,7 @@
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -58,7 +59,13 @@ bool evaluate(const HostTensorPtr& arg, const HostTensorPtr& out) {
                                                INPUT_ET,
                                                OUTPUT_ET);
     } else {
-        runtime::reference::convert(arg->get_data_ptr<INPUT_ET>(), out->get_data_ptr<OUTPUT_ET>(), element_count);
+        const auto src = arg->get_data_ptr<INPUT_ET>();
+        const auto dst = out->get_data_ptr<OUTPUT_ET>();
+        runtime::reference::parallel_for(element_count,
+                                         runtime::reference::parallel_min_elements,
+                                         [&](size_t begin, size_t end) {
+                                             runtime::reference::convert(src + begin, dst + begin, end - begin);
+                                         });
     }
     return true;
 }
@@ -4,8 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <atomic>
 #include <openvino/cc/pass/itt.hpp>
+#include <thread>
+#include <unordered_map>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -51,11 +55,54 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop).
+ *
+ * \param pass  Constant folding pass to run on the subgraphs.
+ * \param node  Node to check.
+ *
+ * \return true if any subgraph was rewritten otherwise false.
+ */
+const auto fold_sub_graphs = [](ov::pass::ConstantFolding& pass, const std::shared_ptr<ov::Node>& node) {
+    bool rewritten = false;
+    if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+        size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+        for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+            rewritten |= pass.run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+        }
+    }
+    return rewritten;
+};
+
+/**
+ * \brief Check if the node can be evaluated concurrently with the other nodes: all its inputs are constants,
+ *        so the evaluation reads only the constants data and creates the new nodes without modifying the graph.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if the node can be evaluated concurrently otherwise false.
+ */
+const auto is_concurrently_foldable = [](const std::shared_ptr<ov::Node>& node) {
+    const auto& inputs = node->input_values();
+    return !inputs.empty() && !ov::pass::constant_folding_is_disabled(node) &&
+           !ov::is_type<ov::op::util::MultiSubGraphOp>(node) &&
+           std::all_of(inputs.cbegin(), inputs.cend(), [](const ov::Output<ov::Node>& input) {
+               return ov::is_type<ov::op::v0::Constant>(input.get_node());
+           });
+};
+
+ov::pass::ConstantFolding::ConstantFolding(size_t num_threads)
+    : m_num_threads(num_threads ? num_threads : std::max(std::thread::hardware_concurrency(), 1u)) {}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    if (m_num_threads > 1) {
+        return fold_by_levels(model, rewritten);
+    }
+
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
             node->validate_and_infer_types();
@@ -64,36 +111,114 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         OutputVector replacements(node->get_output_size());
 
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+            rewritten |= replace_with_folded(node, replacements);
+        } else {
+            rewritten |= fold_sub_graphs(*this, node);
+        }
+    }
 
-                    rewritten = true;
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_by_levels(const std::shared_ptr<ov::Model>& model, bool rewritten) {
+    // Evaluation of the small nodes in separate threads costs more than it saves
+    constexpr size_t min_concurrent_bytes = 256 * 1024;
+
+    // The level of a node is the length of the longest path to it from the nodes without inputs
+    std::vector<NodeVector> levels;
+    std::unordered_map<const Node*, size_t> node_levels;
+    for (const auto& node : model->get_ordered_ops()) {
+        size_t level = 0;
+        for (const auto& input : node->input_values()) {
+            const auto found = node_levels.find(input.get_node());
+            if (found != node_levels.end()) {
+                level = std::max(level, found->second + 1);
+            }
+        }
+        node_levels[node.get()] = level;
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(node);
+    }
+
+    for (const auto& level : levels) {
+        std::vector<size_t> candidates;
+        size_t candidates_bytes = 0;
+        for (size_t i = 0; i < level.size(); ++i) {
+            const auto& node = level[i];
+            if (rewritten) {
+                node->validate_and_infer_types();
+            }
+            if (is_concurrently_foldable(node)) {
+                candidates.push_back(i);
+                for (const auto& input : node->input_values()) {
+                    candidates_bytes += ov::as_type<ov::op::v0::Constant>(input.get_node())->get_byte_size();
                 }
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+        }
+
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> evaluated(level.size(), false);
+        std::vector<char> folded(level.size(), false);
+        if (candidates.size() > 1 && candidates_bytes >= min_concurrent_bytes) {
+            const size_t nthr = std::min(m_num_threads, candidates.size());
+            // the threads which are left are shared by the kernels of the concurrently evaluated nodes
+            const size_t kernel_threads = std::max<size_t>(m_num_threads / nthr, 1);
+            std::atomic<size_t> next{0};
+            ngraph::runtime::reference::parallel_nt(nthr, [&](size_t, size_t) {
+                ngraph::runtime::reference::ParallelScope scope(kernel_threads);
+                for (size_t c = next++; c < candidates.size(); c = next++) {
+                    const auto idx = candidates[c];
+                    const auto& node = level[idx];
+                    replacements[idx] = OutputVector(node->get_output_size());
+                    folded[idx] = node->constant_fold(replacements[idx], node->input_values());
+                    evaluated[idx] = true;
                 }
+            });
+        }
+
+        // The graph is modified sequentially in the topological order
+        for (size_t i = 0; i < level.size(); ++i) {
+            const auto& node = level[i];
+            if (!evaluated[i]) {
+                ngraph::runtime::reference::ParallelScope scope(m_num_threads);
+                replacements[i] = OutputVector(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            }
+            if (folded[i]) {
+                rewritten |= replace_with_folded(node, replacements[i]);
+            } else {
+                rewritten |= fold_sub_graphs(*this, node);
             }
         }
     }
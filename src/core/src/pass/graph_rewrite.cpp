@@ -17,6 +17,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/core/compilation_profile.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -92,6 +93,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
+    const bool profiling_enabled = ov::CompilationProfile::get_current() != nullptr;
 
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
@@ -152,6 +154,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        if (status && profiling_enabled) {
+            ov::CompilationProfile::Stage::add_matcher_hit(m_pass->get_name());
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -20,6 +20,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/core/compilation_profile.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
@@ -72,6 +73,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, pass::perf_counters()[pass->get_type_info()]);
+        ov::CompilationProfile::Stage profile_stage("transformation");
+        if (profile_stage.is_active()) {
+            profile_stage.set_name(pass->get_name());
+        }
 
         pass_timer.start();
 
@@ -1053,7 +1053,9 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    // Deterministic serialization is used for hashing only: the offsets of constants aren't needed there, so
+    // deduplication of the constants data (the serial hash calculation and comparison of each buffer) is skipped
+    ConstantWriter constant_write_handler(bin_file, !deterministic);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1251,14 +1253,26 @@ public:
         return n;
     }
 };
+
+class OstreamNullWrapper final : public std::streambuf {
+public:
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        return n;
+    }
+
+    int_type overflow(int_type c) override {
+        return traits_type::not_eof(c);
+    }
+};
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(Hash);
     OstreamHashWrapper xmlHash;
     OstreamHashWrapper binHash;
+    OstreamNullWrapper binNull;
     std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
+    std::ostream bin(m_hash_constants_data ? static_cast<std::streambuf*>(&binHash) : &binNull);
 
     // Determinism is important for hash calculation
     serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
@@ -1274,4 +1288,8 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
 
 pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
 
+pass::Hash::Hash(uint64_t& output_hash_value, bool hash_constants_data)
+    : m_hash(output_hash_value),
+      m_hash_constants_data(hash_constants_data) {}
+
 }  // namespace ov
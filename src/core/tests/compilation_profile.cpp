@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compilation_profile.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include "openvino/op/abs.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov;
+
+namespace {
+class ReluToAbs : public pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReluToAbs");
+    ReluToAbs() {
+        auto relu = pass::pattern::wrap_type<op::v0::Relu>();
+        matcher_pass_callback callback = [](pass::pattern::Matcher& m) {
+            auto root = m.get_match_root();
+            auto abs = std::make_shared<op::v0::Abs>(root->input_value(0));
+            abs->set_friendly_name(root->get_friendly_name());
+            replace_node(root, abs);
+            return true;
+        };
+        register_matcher(std::make_shared<pass::pattern::Matcher>(relu, "ReluToAbs"), callback);
+    }
+};
+
+class NestedManagerPass : public pass::ModelPass {
+public:
+    OPENVINO_RTTI("NestedManagerPass");
+    bool run_on_model(const std::shared_ptr<Model>& model) override {
+        pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<ReluToAbs>();
+        manager.run_passes(model);
+        return false;
+    }
+};
+
+std::shared_ptr<Model> make_model() {
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3});
+    auto relu1 = std::make_shared<op::v0::Relu>(param);
+    auto relu2 = std::make_shared<op::v0::Relu>(relu1);
+    return std::make_shared<Model>(OutputVector{relu2}, ParameterVector{param});
+}
+}  // namespace
+
+TEST(compilation_profile, no_records_without_scope) {
+    auto profile = std::make_shared<CompilationProfile>();
+    {
+        CompilationProfile::Stage stage("frontend", "model");
+        EXPECT_FALSE(stage.is_active());
+    }
+    pass::Manager manager;
+    manager.register_pass<ReluToAbs>();
+    manager.run_passes(make_model());
+
+    EXPECT_EQ(CompilationProfile::get_current(), nullptr);
+    EXPECT_TRUE(profile->get_records().empty());
+}
+
+TEST(compilation_profile, transformation_records_with_matcher_hits) {
+    auto profile = std::make_shared<CompilationProfile>();
+    {
+        CompilationProfile::Scope scope{profile};
+        EXPECT_EQ(CompilationProfile::get_current(), profile);
+
+        CompilationProfile::Stage stage("plugin_compile", "model");
+        EXPECT_TRUE(stage.is_active());
+        pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<NestedManagerPass>();
+        manager.run_passes(make_model());
+    }
+    EXPECT_EQ(CompilationProfile::get_current(), nullptr);
+
+    const auto records = profile->get_records();
+    ASSERT_EQ(records.size(), 3u);
+
+    EXPECT_EQ(records[0].stage, "plugin_compile");
+    EXPECT_EQ(records[0].name, "model");
+    EXPECT_EQ(records[0].depth, 0u);
+
+    EXPECT_EQ(records[1].stage, "transformation");
+    EXPECT_NE(records[1].name.find("NestedManagerPass"), std::string::npos);
+    EXPECT_EQ(records[1].depth, 1u);
+    EXPECT_TRUE(records[1].matcher_hits.empty());
+
+    EXPECT_EQ(records[2].stage, "transformation");
+    EXPECT_EQ(records[2].name, "ReluToAbs");
+    EXPECT_EQ(records[2].depth, 2u);
+    ASSERT_EQ(records[2].matcher_hits.size(), 1u);
+    EXPECT_EQ(records[2].matcher_hits.at("ReluToAbs"), 2u);
+
+    for (size_t i = 1; i < records.size(); ++i) {
+        EXPECT_GE(records[i].start_us, records[i - 1].start_us);
+        EXPECT_LE(records[i].duration_us, records[i - 1].duration_us);
+    }
+}
+
+TEST(compilation_profile, scopes_are_nested_and_thread_local) {
+    auto outer = std::make_shared<CompilationProfile>();
+    auto inner = std::make_shared<CompilationProfile>();
+    {
+        CompilationProfile::Scope outer_scope{outer};
+        {
+            CompilationProfile::Scope inner_scope{inner};
+            CompilationProfile::Stage stage("graph_init", "inner");
+        }
+        std::thread([&] {
+            EXPECT_EQ(CompilationProfile::get_current(), nullptr);
+            CompilationProfile::Scope thread_scope{outer};
+            CompilationProfile::Stage stage("graph_init", "stream");
+        }).join();
+        CompilationProfile::Stage stage("frontend", "outer");
+    }
+
+    const auto inner_records = inner->get_records();
+    ASSERT_EQ(inner_records.size(), 1u);
+    EXPECT_EQ(inner_records[0].name, "inner");
+
+    const auto outer_records = outer->get_records();
+    ASSERT_EQ(outer_records.size(), 2u);
+    EXPECT_EQ(outer_records[0].name, "stream");
+    EXPECT_EQ(outer_records[1].name, "outer");
+    EXPECT_EQ(outer->get_total_duration("graph_init"), outer_records[0].duration_us);
+}
+
+TEST(compilation_profile, to_json) {
+    CompilationProfile profile;
+    EXPECT_EQ(profile.to_json(), "{\"records\": []}");
+
+    CompilationProfile::Record record;
+    record.stage = "transformation";
+    record.name = "ns::Pass<\"x\">";
+    record.depth = 1;
+    record.start_us = 10;
+    record.duration_us = 20;
+    record.matcher_hits = {{"A", 1}, {"B", 2}};
+    profile.add_record(record);
+
+    EXPECT_EQ(profile.to_json(),
+              "{\"records\": [\n"
+              "  {\"stage\": \"transformation\", \"name\": \"ns::Pass<\\\"x\\\">\", \"depth\": 1, \"start_us\": 10, "
+              "\"duration_us\": 20, \"matcher_hits\": {\"A\": 1, \"B\": 2}}\n"
+              "]}");
+
+    std::stringstream ss;
+    ss << profile;
+    EXPECT_EQ(ss.str(), profile.to_json());
+
+    const CompilationProfile copy = profile;
+    EXPECT_EQ(copy.to_json(), profile.to_json());
+}
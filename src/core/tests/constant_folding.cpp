@@ -4,6 +4,10 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -3584,3 +3588,119 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+// Weights decompression chains: Convert -> Multiply by per-row scales -> Transpose -> Gather/Concat
+static std::shared_ptr<ov::Model> make_weights_folding_model(size_t num_chains, size_t rows, size_t cols) {
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{cols, rows});
+    ov::ResultVector results;
+    for (size_t i = 0; i < num_chains; ++i) {
+        std::vector<int8_t> weights_values(rows * cols);
+        for (size_t j = 0; j < weights_values.size(); ++j) {
+            weights_values[j] = static_cast<int8_t>((j * 7 + i) % 255 - 127);
+        }
+        std::vector<float> scales_values(rows);
+        for (size_t j = 0; j < rows; ++j) {
+            scales_values[j] = 0.01f * static_cast<float>(j % 17 + i + 1);
+        }
+        std::vector<int32_t> indices_values(cols / 2);
+        for (size_t j = 0; j < indices_values.size(); ++j) {
+            indices_values[j] = static_cast<int32_t>((j * 3) % cols);
+        }
+
+        auto weights = op::Constant::create(element::i8, Shape{rows, cols}, weights_values);
+        auto convert = std::make_shared<op::v0::Convert>(weights, element::f32);
+        auto scales = op::Constant::create(element::f32, Shape{rows, 1}, scales_values);
+        auto multiply = std::make_shared<op::v1::Multiply>(convert, scales);
+        auto order = op::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto transpose = std::make_shared<op::v1::Transpose>(multiply, order);
+        auto indices = op::Constant::create(element::i32, Shape{indices_values.size()}, indices_values);
+        auto axis = op::Constant::create(element::i64, Shape{}, {0});
+        auto gather = std::make_shared<op::v1::Gather>(transpose, indices, axis);
+        auto concat = std::make_shared<op::v0::Concat>(OutputVector{gather, transpose}, 0);
+        concat->set_friendly_name("concat_" + std::to_string(i));
+        auto add = std::make_shared<op::v1::Add>(data, transpose);
+        results.push_back(std::make_shared<op::Result>(concat));
+        results.push_back(std::make_shared<op::Result>(add));
+    }
+    return std::make_shared<ov::Model>(results, ParameterVector{data});
+}
+
+static void check_parallel_folding(size_t num_chains, size_t num_threads) {
+    auto model = make_weights_folding_model(num_chains, 256, 512);
+    auto model_parallel = model->clone();
+
+    run_constant_folding(model);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<pass::ConstantFolding>(num_threads);
+    pass_manager.run_passes(model_parallel);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model_parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Concat>(model_parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model_parallel), num_chains);
+    for (size_t i = 0; i < num_chains; ++i) {
+        auto expected = get_result_constant(model, 2 * i);
+        auto actual = get_result_constant(model_parallel, 2 * i);
+        ASSERT_TRUE(expected);
+        ASSERT_TRUE(actual);
+        ASSERT_EQ(expected->get_friendly_name(), actual->get_friendly_name());
+        ASSERT_EQ(expected->get_shape(), actual->get_shape());
+        ASSERT_EQ(0, std::memcmp(expected->get_data_ptr(), actual->get_data_ptr(), expected->get_byte_size()));
+
+        auto expected_add_input = get_result_constant(model, 2 * i + 1);
+        ASSERT_FALSE(expected_add_input);
+        auto expected_transposed = ov::as_type_ptr<op::Constant>(
+            model->get_results()[2 * i + 1]->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1));
+        auto actual_transposed = ov::as_type_ptr<op::Constant>(
+            model_parallel->get_results()[2 * i + 1]->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(expected_transposed);
+        ASSERT_TRUE(actual_transposed);
+        ASSERT_EQ(0,
+                  std::memcmp(expected_transposed->get_data_ptr(),
+                              actual_transposed->get_data_ptr(),
+                              expected_transposed->get_byte_size()));
+    }
+}
+
+TEST(constant_folding, parallel_independent_subgraphs) {
+    check_parallel_folding(4, 4);
+}
+
+TEST(constant_folding, parallel_kernels) {
+    check_parallel_folding(1, 4);
+}
+
+TEST(constant_folding, parallel_more_threads_than_nodes) {
+    check_parallel_folding(3, 16);
+}
+
+TEST(benchmark, constant_folding_parallel) {
+    const size_t num_chains = 8;
+    const size_t num_threads = std::max(std::thread::hardware_concurrency(), 2u);
+    auto model = make_weights_folding_model(num_chains, 1024, 1024);
+    auto model_parallel = model->clone();
+
+    auto start = std::chrono::steady_clock::now();
+    pass::Manager sequential;
+    sequential.register_pass<pass::ConstantFolding>();
+    sequential.run_passes(model);
+    auto sequential_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    pass::Manager parallel;
+    parallel.register_pass<pass::ConstantFolding>(num_threads);
+    parallel.run_passes(model_parallel);
+    auto parallel_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "constant folding of " << num_chains << " weights chains, sequential: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(sequential_time).count() << "ms, "
+              << num_threads << " threads: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(parallel_time).count() << "ms" << std::endl;
+
+    for (size_t i = 0; i < num_chains; ++i) {
+        auto expected = get_result_constant(model, 2 * i);
+        auto actual = get_result_constant(model_parallel, 2 * i);
+        ASSERT_TRUE(expected && actual);
+        ASSERT_EQ(0, std::memcmp(expected->get_data_ptr(), actual->get_data_ptr(), expected->get_byte_size()));
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(xxhash, reference_values) {
+    EXPECT_EQ(0xEF46DB3751D8E999ull, ov::util::xxh64("", 0));
+    EXPECT_EQ(0x44BC2CF5AD770999ull, ov::util::xxh64("abc", 3));
+    // the long buffer goes through the four lanes
+    const std::string long_str = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(0xFBCEA83C8A378BF1ull, ov::util::xxh64(long_str.data(), long_str.size()));
+    EXPECT_EQ(0xB559B98D844E0635ull, ov::util::xxh64("xxhash", 6, 20141025));
+}
+
+TEST(xxhash, unaligned_buffer) {
+    std::vector<char> buffer(100, 1);
+    const std::vector<char> expected(buffer.begin(), buffer.begin() + 67);
+    EXPECT_EQ(ov::util::xxh64(expected.data(), expected.size()), ov::util::xxh64(buffer.data() + 3, 67));
+}
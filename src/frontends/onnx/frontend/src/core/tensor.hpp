@@ -80,6 +80,12 @@ inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_
     return std::vector<T>(it, it + (raw_data.size() / onnx_common::get_onnx_data_size(onnx_data_type)));
 }
 
+template <typename T>
+inline std::vector<T> __get_raw_data(const ExternalDataBuffer& buffer, int onnx_data_type) {
+    auto it = buffer->get_ptr<const T>();
+    return std::vector<T>(it, it + (buffer->size() / onnx_common::get_onnx_data_size(onnx_data_type)));
+}
+
 }  // namespace
 }  // namespace detail
 
@@ -106,10 +112,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = {})
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -195,6 +204,9 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data()) {
+            return make_ng_constant_from_external_data(get_ng_type());
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -236,15 +248,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
-        if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -280,14 +284,33 @@ private:
         return constant;
     }
 
+    /// \brief Creates the constant as a view of the external data buffer, so the data isn't copied once more.
+    ///        The buffer (and the file mapping, if any) lives as long as the constant.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_external_data(const element::Type& type) const {
+        const auto external_data = load_external_data();
+        if (type.size() * shape_size(m_shape) != external_data->size()) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
-    std::string load_external_data() const {
+    detail::ExternalDataBuffer load_external_data() const {
         const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        if (m_mmap_cache) {
+            return tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+        }
         return tensor_external_data.load_external_data(m_model_dir);
     }
 
@@ -337,6 +360,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
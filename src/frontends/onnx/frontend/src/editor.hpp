@@ -18,6 +18,10 @@
 #include "openvino/frontend/extension/progress_reporter.hpp"
 #include "openvino/frontend/extension/telemetry.hpp"
 
+namespace ov {
+class MappedMemory;
+}  // namespace ov
+
 namespace ov {
 namespace onnx_editor {
 /// \brief A class representing a set of utilities allowing modification of an ONNX model
@@ -31,9 +35,14 @@ public:
     ///        is parsed and loaded into the m_model_proto member variable.
     ///
     /// \param model_path Path to the file containing the model.
-    ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions = {});
+    /// \param enable_mmap Map the external data files to the memory instead of reading them.
+    ONNXModelEditor(const std::string& model_path,
+                    const bool enable_mmap = false,
+                    frontend::ExtensionHolder extensions = {});
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    ONNXModelEditor(const std::wstring& model_path, frontend::ExtensionHolder extensions = {});
+    ONNXModelEditor(const std::wstring& model_path,
+                    const bool enable_mmap = false,
+                    frontend::ExtensionHolder extensions = {});
 #endif
 
     /// \brief Creates an editor from a model stream. The stream is parsed and loaded
@@ -42,8 +51,10 @@ public:
     /// \param model_stream The stream containing the model.
     /// \param model_path Path to the file containing the model. This information can be used
     ///                   for ONNX external weights feature support.
+    /// \param enable_mmap Map the external data files to the memory instead of reading them.
     ONNXModelEditor(std::istream& model_stream,
                     const std::string& path = {},
+                    const bool enable_mmap = false,
                     frontend::ExtensionHolder extensions = {});
 
     /// \brief Modifies the in-memory representation of the model by setting
@@ -298,6 +309,8 @@ private:
 
     frontend::ExtensionHolder m_extensions;
     const std::string m_model_path;
+    // the external data files mapped to the memory, shared by all the functions created by the editor
+    std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>> m_mmap_cache;
 
     struct Impl;
     std::unique_ptr<Impl, void (*)(Impl*)> m_pimpl;
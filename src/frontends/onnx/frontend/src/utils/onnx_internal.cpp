@@ -88,20 +88,23 @@ void convert_decoded_function(std::shared_ptr<Function> function) {
 
 std::shared_ptr<Function> import_onnx_model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                             const std::string& model_path,
+                                            detail::MappedMemoryHandles mmap_cache,
                                             ov::frontend::ExtensionHolder extensions) {
     apply_transformations(*model_proto);
     NGRAPH_SUPPRESS_DEPRECATED_START
-    Graph graph{file_util::get_directory(model_path), model_proto, std::move(extensions)};
+    Graph graph{file_util::get_directory(model_path), model_proto, std::move(mmap_cache), std::move(extensions)};
     NGRAPH_SUPPRESS_DEPRECATED_END
     return graph.convert();
 }
 
 std::shared_ptr<Function> decode_to_framework_nodes(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
                                                     const std::string& model_path,
+                                                    detail::MappedMemoryHandles mmap_cache,
                                                     ov::frontend::ExtensionHolder extensions) {
     apply_transformations(*model_proto);
     NGRAPH_SUPPRESS_DEPRECATED_START
-    auto graph = std::make_shared<Graph>(file_util::get_directory(model_path), model_proto, extensions);
+    auto graph =
+        std::make_shared<Graph>(file_util::get_directory(model_path), model_proto, std::move(mmap_cache), extensions);
     NGRAPH_SUPPRESS_DEPRECATED_END
     return graph->decode();
 }
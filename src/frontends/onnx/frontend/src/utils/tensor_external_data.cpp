@@ -31,7 +31,7 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-std::string TensorExternalData::load_external_data(const std::string& model_dir) const {
+ExternalDataBuffer TensorExternalData::load_external_data(const std::string& model_dir) const {
     NGRAPH_SUPPRESS_DEPRECATED_START
 
     auto full_path = file_util::path_join(model_dir, m_data_location);
@@ -51,7 +51,7 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     if (filesize == -1) {
         throw error::invalid_external_data{*this};
     }
-    if (m_offset + m_data_length > filesize) {
+    if (m_offset + m_data_length > static_cast<uint64_t>(filesize)) {
         throw error::invalid_external_data{*this};
     }
 
@@ -64,12 +64,56 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
+    // the data is read once, directly to the buffer the constant is created on
+    auto read_data = std::make_shared<ngraph::runtime::AlignedBuffer>(read_data_length);
+    external_data_stream.read(read_data->get_ptr<char>(), read_data_length);
     external_data_stream.close();
 
-    return read_data;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<void>>>(read_data->get_ptr<char>(),
+                                                                                 read_data->size(),
+                                                                                 read_data);
+}
+
+ExternalDataBuffer TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                               MappedMemoryHandles cache) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    file_util::convert_path_win_style(full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    const auto cached = cache->find(full_path);
+    if (cached != cache->end()) {
+        mapped_memory = cached->second;
+    } else {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+            mapped_memory = ov::load_mmap_object(full_path);
+#endif
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        (*cache)[full_path] = mapped_memory;
+    }
+
+    const uint64_t filesize = mapped_memory->size();
+    if (m_offset > filesize || m_offset + m_data_length > filesize) {
+        throw error::invalid_external_data{*this};
+    }
+
+    uint64_t read_data_length = m_data_length > 0 ? m_data_length : filesize - m_offset;
+
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<void>>>(mapped_memory->data() + m_offset,
+                                                                                 read_data_length,
+                                                                                 mapped_memory);
 }
 
 std::string TensorExternalData::to_string() const {
@@ -6,9 +6,22 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  External data of a tensor, the buffer owns (or shares the ownership of) the memory it points to
+using ExternalDataBuffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<void>>>;
+/// \brief  The external data files mapped to the memory, by full path. Each file is mapped once and shared by
+///         all the tensors stored in it.
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -16,12 +29,20 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data(const std::string& model_dir) const;
+    /// \return     External binary data read into an aligned buffer
+    ExternalDataBuffer load_external_data(const std::string& model_dir) const;
+
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       The file is mapped once and stored in the cache, the next tensors of the same file
+    ///             point to the existing mapping. If mapping of the file fails,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     External binary data as a view of the file mapping, the buffer keeps the mapping alive
+    ExternalDataBuffer load_external_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const;
 
     /// \brief      Represets parameter of external data as string
     ///
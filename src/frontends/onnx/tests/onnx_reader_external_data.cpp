@@ -10,6 +10,7 @@
 #include <fstream>
 #include <ie_core.hpp>
 #include <ngraph/ngraph.hpp>
+#include <openvino/runtime/core.hpp>
 #include <set>
 #include <streambuf>
 #include <string>
@@ -51,6 +52,24 @@ TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
     ASSERT_TRUE(external_data_node_const->get_vector<float>() == (std::vector<float>{1, 2, 3, 4}));
 }
 
+TEST(ONNX_Reader_Tests, ImportModelWithMappedExternalData) {
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    auto model = core.read_model(
+        CommonTestUtils::getModelFromTestModelZoo(std::string(ONNX_TEST_MODELS) + "onnx_external_data.onnx"));
+
+    std::shared_ptr<ov::op::v0::Constant> external_data_node;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            ASSERT_EQ(external_data_node, nullptr);
+            external_data_node = constant;
+        }
+    }
+    ASSERT_NE(external_data_node, nullptr);
+    // the constant keeps the file mapping alive after the model is read
+    ASSERT_TRUE(external_data_node->get_vector<float>() == (std::vector<float>{1, 2, 3, 4}));
+}
+
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromStringException) {
     InferenceEngine::Core ie;
     const auto path =
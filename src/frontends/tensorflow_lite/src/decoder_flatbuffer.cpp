@@ -87,7 +87,8 @@ std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace> DecoderFlatBuffe
         ov::frontend::tensorflow_lite::get_quantization(tensor->quantization()),
         tensor_info.input_idx,
         tensor_info.output_idx,
-        (tensor_info.buffer->data() ? tensor_info.buffer->data()->data() : nullptr));
+        (tensor_info.buffer->data() ? tensor_info.buffer->data()->data() : nullptr),
+        (tensor_info.buffer->data() ? tensor_info.buffer->data()->size() : 0));
 }
 
 }  // namespace tensorflow_lite
@@ -8,24 +8,37 @@ using namespace ov::frontend::tensorflow_lite;
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
-    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path)) {}
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path) {
+    std::shared_ptr<ov::MappedMemory> model_memory;
+    try {
+#    ifdef _WIN32
+        model_memory = ov::load_mmap_object(path);
+#    else
+        model_memory = ov::load_mmap_object(ov::util::wstring_to_string(path));
+#    endif
+    } catch (const std::runtime_error&) {
+        FRONT_END_GENERAL_CHECK(false, "Model file does not exist: ", ov::util::wstring_to_string(path));
+    }
+    init_model(model_memory);
+}
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file;
-    model_file.open(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    model_file.seekg(0, std::ios::end);
-    auto length = model_file.tellg();
-    model_file.seekg(0, std::ios::beg);
-    char* data = new char[length];
-    model_file.read(data, length);
-    model_file.close();
+    std::shared_ptr<ov::MappedMemory> model_memory;
+    try {
+        model_memory = ov::load_mmap_object(path);
+    } catch (const std::runtime_error&) {
+        FRONT_END_GENERAL_CHECK(false, "Model file does not exist: ", path);
+    }
+    init_model(model_memory);
+}
 
-    m_model = std::shared_ptr<tflite::Model>(tflite::GetMutableModel(data), [](tflite::Model* p) {});
+void GraphIteratorFlatBuffer::init_model(const std::shared_ptr<ov::MappedMemory>& model_memory) {
+    FRONT_END_GENERAL_CHECK(model_memory->size() > 0, "Model file is empty");
+    // FlatBuffers are read in place: the model is a view of the mapped file and shares its ownership
+    m_model_memory = model_memory;
+    m_model = std::shared_ptr<tflite::Model>(m_model_memory, tflite::GetMutableModel(m_model_memory->data()));
     const auto subgraphs = m_model->subgraphs();
     FRONT_END_GENERAL_CHECK(subgraphs->size() == 1,
                             "Number of sub-graphs in the model is ",
@@ -9,6 +9,7 @@
 #include "decoder_flatbuffer.h"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -25,8 +26,11 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<const tflite::Operator*> m_nodes;
+    std::shared_ptr<ov::MappedMemory> m_model_memory;
     std::shared_ptr<tflite::Model> m_model;
 
+    void init_model(const std::shared_ptr<ov::MappedMemory>& model_memory);
+
 public:
     explicit GraphIteratorFlatBuffer(const std::string& path);
 
@@ -58,6 +62,12 @@ public:
 
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
+
+    /// Return the memory the model file is mapped to. Tensor buffers point into it, so Constants can be created as
+    /// views of the mapping and keep it alive
+    std::shared_ptr<ov::MappedMemory> get_model_memory() const {
+        return m_model_memory;
+    }
 };
 
 }  // namespace tensorflow_lite
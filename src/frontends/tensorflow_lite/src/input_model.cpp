@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -79,6 +80,7 @@ private:
 void InputModel::InputModelTFLiteImpl::loadModel() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
+    const auto model_memory = m_graph_iterator->get_model_memory();
     m_op_places.reserve(m_graph_iterator->size());
     for (; !m_graph_iterator->is_end(); m_graph_iterator->next()) {
         const auto& decoder = m_graph_iterator->get_decoder();
@@ -97,9 +99,18 @@ void InputModel::InputModelTFLiteImpl::loadModel() {
                     // will reorder by index later
                     m_inputs.push_back(place);
                 } else if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    const auto& element_type = place->get_element_type();
+                    const auto shape = place->get_partial_shape().to_shape();
+                    const auto byte_size = (ov::shape_size(shape) * element_type.bitwidth() + 7) / 8;
+                    FRONT_END_GENERAL_CHECK(byte_size <= place->get_data_size(),
+                                            "The size of the buffer does not match the byte size of a constant tensor ",
+                                            name);
+                    // the constant is a view of the mapped model file, the buffer keeps the mapping alive
+                    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                        static_cast<char*>(const_cast<void*>(data)),
+                        place->get_data_size(),
+                        model_memory);
+                    auto constant = std::make_shared<ov::op::v0::Constant>(element_type, shape, buffer);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else {
@@ -25,12 +25,14 @@ public:
                     std::shared_ptr<ov::frontend::tensorflow_lite::QuantizationInfo> quantization,
                     int64_t input_idx,
                     int64_t output_idx,
-                    const void* data)
+                    const void* data,
+                    size_t data_size = 0)
         : ov::frontend::tensorflow::TensorPlace(input_model, pshape, type, names),
           m_quantization(quantization),
           m_input_idx(input_idx),
           m_output_idx(output_idx),
-          m_data(data){};
+          m_data(data),
+          m_data_size(data_size){};
 
     void translate(ov::Output<ov::Node>& output, bool convert_tensor_attrs_to_nodes = false);
 
@@ -59,10 +61,15 @@ public:
         return m_data;
     }
 
+    size_t get_data_size() const {
+        return m_data_size;
+    }
+
 protected:
     std::shared_ptr<ov::frontend::tensorflow_lite::QuantizationInfo> m_quantization;
     int64_t m_input_idx, m_output_idx;
     const void* m_data;
+    size_t m_data_size;
 };
 
 }  // namespace tensorflow_lite
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset10.hpp>
+
+#include "gtest/gtest.h"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace std;
+using namespace ov;
+using namespace ov::opset10;
+using namespace ov::frontend;
+
+TEST(FrontEndConvertTrickyModels, constant_outlives_frontend) {
+    shared_ptr<Model> model;
+    {
+        // the constants are views of the model file, so they must keep the file mapped on their own
+        FrontEndManager fem;
+        auto front_end = fem.load_by_framework(TF_LITE_FE);
+        ASSERT_NE(front_end, nullptr);
+        auto model_filename = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) +
+                                                                 "constant_lifetime/constant_lifetime.tflite");
+        auto input_model = front_end->load(model_filename);
+        ASSERT_NE(input_model, nullptr);
+        model = front_end->convert(input_model);
+        ASSERT_NE(model, nullptr);
+    }
+
+    shared_ptr<Constant> constant;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (const auto candidate = as_type_ptr<Constant>(node)) {
+            if (shape_size(candidate->get_shape()) == 6) {
+                constant = candidate;
+            }
+        }
+    }
+    ASSERT_NE(constant, nullptr);
+    EXPECT_EQ(constant->cast_vector<float>(), vector<float>({1.f, 2.f, 3.f, 4.f, 5.f, 6.f}));
+}
@@ -0,0 +1,34 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+
+# do not print messages from TensorFlow
+os.environ['TF_CPP_MIN_LOG_LEVEL'] = '3'
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model
+with tf.compat.v1.Session() as sess:
+    input1 = tf.compat.v1.placeholder(tf.float32, [2, 3], 'x')
+    constant = tf.constant(np.array([[1, 2, 3], [4, 5, 6]]), dtype=tf.float32)
+    add = tf.add(input1, constant, name="add")
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+path_to_model_dir = os.path.join(sys.argv[1], "constant_lifetime")
+tf_file_name = 'constant_lifetime.pb'
+tflite_file_name = 'constant_lifetime.tflite'
+tf.io.write_graph(tf_net, path_to_model_dir, tf_file_name, False)
+
+converter = tf.compat.v1.lite.TFLiteConverter.from_frozen_graph(os.path.join(path_to_model_dir, tf_file_name),
+                                                                ["x"], ["add"])
+tflite_model = converter.convert()
+
+tflite_model_path = os.path.join(path_to_model_dir, tflite_file_name)
+with tf.io.gfile.GFile(tflite_model_path, 'wb') as f:
+    f.write(tflite_model)
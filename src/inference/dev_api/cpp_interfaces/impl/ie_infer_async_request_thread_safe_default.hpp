@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <exception>
 #include <future>
 #include <map>
@@ -15,6 +16,7 @@
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "openvino/runtime/exception.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
@@ -98,6 +100,8 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
                 break;
             }
             _state = InferState::Busy;
+            _deadlineTime = _deadline.count() > 0 ? std::chrono::steady_clock::now() + _deadline
+                                                  : std::chrono::steady_clock::time_point::max();
         }
         if (state != InferState::Stop) {
             try {
@@ -273,6 +277,11 @@ public:
         _callback = std::move(callback);
     }
 
+    void SetProperties(const ov::AnyMap& properties) override {
+        CheckState();
+        IInferRequestInternal::SetProperties(properties);
+    }
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
         CheckState();
         return _syncRequest->QueryState();
@@ -322,7 +331,17 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor), true));
+    }
+
+    /**
+     * @brief Marks the request as started, so it is not dropped by the ov::hint::request_deadline check before the
+     * first pipeline stage.
+     * @note Should be called from StartAsync_ThreadUnsafe() or Infer_ThreadUnsafe() by the plugins which submit the
+     * inference work to a device before the pipeline is run
+     */
+    void SetExecutionStarted() {
+        _deadlineTime = std::chrono::steady_clock::time_point::max();
     }
 
     /**
@@ -381,6 +400,21 @@ protected:
     }
 
 private:
+    /**
+     * @brief Runs the stage task with the request priority, the executors without priorities run it in FIFO order
+     * @param executor The stage executor
+     * @param task The stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        if (_priority == ov::hint::Priority::MEDIUM) {
+            executor->run(std::move(task));
+        } else {
+            executor->runWithPriority(std::move(task),
+                                      _priority == ov::hint::Priority::HIGH ? ITaskExecutor::TaskPriority::HIGH
+                                                                            : ITaskExecutor::TaskPriority::LOW);
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -391,17 +425,25 @@ private:
      * @param[in]  itStage Iterator to next stage of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Executor that will run final stage with callback call
+     * @param[in]  checkDeadline Whether the request is dropped before the stage if its deadline is exceeded
      * @return A next stage task
      */
     Task MakeNextStageTask(const Pipeline::iterator itStage,
                            const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
+                           const ITaskExecutor::Ptr callbackExecutor,
+                           const bool checkDeadline = false) {
         return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
+            [this, itStage, itEndStage, checkDeadline](ITaskExecutor::Ptr& callbackExecutor) mutable {
                 std::exception_ptr currentException = nullptr;
                 auto& thisStage = *itStage;
                 auto itNextStage = itStage + 1;
                 try {
+                    // the expired request is dropped before its first stage, the started one is never interrupted
+                    if (checkDeadline && _deadlineTime != std::chrono::steady_clock::time_point::max() &&
+                        std::chrono::steady_clock::now() > _deadlineTime) {
+                        throw ov::DeadlineExceeded{"The inference request deadline of " +
+                                                   std::to_string(_deadline.count()) + " ms is exceeded"};
+                    }
                     auto& stageTask = std::get<Stage_e::task>(thisStage);
                     IE_ASSERT(nullptr != stageTask);
                     stageTask();
@@ -409,7 +451,8 @@ private:
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        RunStage(nextStageExecutor,
+                                 MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
                     }
                 } catch (...) {
                     currentException = std::current_exception();
@@ -456,5 +499,6 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    std::chrono::steady_clock::time_point _deadlineTime = std::chrono::steady_clock::time_point::max();
 };
 }  // namespace InferenceEngine
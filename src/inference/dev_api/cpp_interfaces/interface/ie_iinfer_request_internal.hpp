@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -14,6 +15,7 @@
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
 #include "openvino/core/node_output.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "so_ptr.hpp"
 
 namespace InferenceEngine {
@@ -196,6 +198,19 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets the request properties: ov::hint::request_priority and ov::hint::request_deadline
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void SetProperties(const ov::AnyMap& properties);
+
+    /**
+     * @brief Gets the request property
+     * @param name Property name
+     * @return Property value
+     */
+    virtual ov::Any GetProperty(const std::string& name) const;
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -356,6 +371,8 @@ protected:
      */
     std::shared_ptr<void> _so;
     Callback _callback;  //!< A callback
+    ov::hint::Priority _priority = ov::hint::Priority::MEDIUM;  //!< Priority of the request in the executor queue
+    std::chrono::milliseconds _deadline{0};  //!< Time given to the request to start the execution, zero for unlimited
 
 private:
     void* _userData = nullptr;
@@ -92,6 +92,14 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables the CPU plugin to omit from the model cache the weights which are consumed only through their
+ * prepared (e.g. reordered) copy stored in the cache as well. Takes effect only if the cache dir is set, so the model
+ * can be compiled from the original one if the cache entry can't be used. Possible values: YES, NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CACHE_ELIDE_WEIGHTS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
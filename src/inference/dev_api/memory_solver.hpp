@@ -12,6 +12,8 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -106,6 +108,18 @@ public:
         return ts_f - rm_ts_f;
     }
 
+    /** @brief Memory planning strategy */
+    enum class Strategy {
+        /** The boxes are placed from the biggest to the smallest one at the lowest free offset */
+        GREEDY_BY_SIZE,
+        /**
+         * Several placement orders (by size, by size * lifetime, by lifetime) are combined with the first-fit and
+         * the best-fit offset selection together with GREEDY_BY_SIZE, the plan with the smallest size is taken.
+         * It is never worse than GREEDY_BY_SIZE and stops as soon as a plan reaches the lower bound (maxDepth).
+         */
+        BEST_OF_HEURISTICS
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
         // TODO: add validation of data correctness:
         // 1. Box.start >= 0 and Box.finish >= -1
@@ -127,10 +141,50 @@ public:
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy The planning strategy
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve() {
+    int64_t solve(Strategy strategy = Strategy::GREEDY_BY_SIZE) {
         maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+        std::map<int64_t, int64_t> best_offsets;
+        int64_t best_required = -1;
+        if (strategy == Strategy::BEST_OF_HEURISTICS) {
+            using Order = std::function<bool(const Box&, const Box&)>;
+            const std::vector<Order> orders = {
+                [](const Box& l, const Box& r) {
+                    return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+                },
+                [](const Box& l, const Box& r) {
+                    return l.size * (l.finish - l.start + 1) > r.size * (r.finish - r.start + 1);
+                },
+                [](const Box& l, const Box& r) {
+                    return l.finish - l.start > r.finish - r.start ||
+                           (l.finish - l.start == r.finish - r.start && l.size > r.size);
+                },
+            };
+            for (const auto& order : orders) {
+                for (bool best_fit : {false, true}) {
+                    std::vector<Box> boxes(_boxes);
+                    std::stable_sort(boxes.begin(), boxes.end(), order);
+                    std::map<int64_t, int64_t> offsets;
+                    const int64_t required = place(boxes, best_fit, offsets);
+                    if (best_required == -1 || required < best_required) {
+                        best_required = required;
+                        best_offsets.swap(offsets);
+                    }
+                    if (best_required == _depth)
+                        break;  // the lower bound is reached
+                }
+                if (best_required == _depth)
+                    break;
+            }
+            if (best_required == _depth) {
+                _offsets.swap(best_offsets);
+                return best_required;
+            }
+        }
+
         std::vector<std::vector<const Box*>> time_slots(_time_duration);
         for (auto& slot : time_slots)
             slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
@@ -169,6 +223,10 @@ public:
             _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
         }
 
+        if (best_required != -1 && best_required < _min_required) {
+            _offsets.swap(best_offsets);
+            return best_required;
+        }
         return _min_required;
     }
 
@@ -194,6 +252,48 @@ public:
     }
 
 private:
+    /**
+     * @brief Places the boxes in the given order, each box is put into a free gap between the already placed boxes
+     *        which intersect it in time: the lowest gap (first-fit) or the smallest one (best-fit).
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t place(std::vector<Box>& boxes, bool best_fit, std::map<int64_t, int64_t>& offsets) const {
+        std::vector<std::vector<const Box*>> time_slots(_time_duration);
+        std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of the intersecting boxes
+        int64_t min_required = 0;
+
+        for (Box& box : boxes) {
+            busy.clear();
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                for (auto* box_in_slot : time_slots[i_slot])
+                    busy.emplace_back(box_in_slot->id, box_in_slot->id + box_in_slot->size);
+            std::sort(busy.begin(), busy.end());
+
+            int64_t offset = -1;
+            int64_t best_gap = std::numeric_limits<int64_t>::max();
+            int64_t gap_begin = 0;
+            for (const auto& interval : busy) {
+                const int64_t gap = interval.first - gap_begin;
+                if (gap >= box.size && gap > 0 && gap < best_gap) {
+                    offset = gap_begin;
+                    best_gap = gap;
+                    if (!best_fit)
+                        break;
+                }
+                gap_begin = std::max(gap_begin, interval.second);
+            }
+            if (offset == -1)
+                offset = gap_begin;  // above all the intersecting boxes
+
+            offsets[box.id] = offset;
+            box.id = offset;  // id is used as an offset storage for the placed boxes
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                time_slots[i_slot].push_back(&box);
+            min_required = std::max(min_required, offset + box.size);
+        }
+        return min_required;
+    }
+
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
@@ -207,16 +307,18 @@ private:
 
         for (const Box& box : _boxes) {
             int64_t time = box.start;
+            // release the boxes finished before the current one starts
+            while (!release_at.empty() && release_at.begin()->first <= time) {
+                for (const Box* b : release_at.begin()->second) {
+                    depth -= b->size;
+                    top_depth--;
+                }
+                release_at.erase(release_at.begin());
+            }
+
             depth += box.size;
             top_depth++;
-
             release_at[box.finish + 1].push_back(&box);
-
-            for (const Box* b : release_at[time]) {
-                depth -= b->size;
-                top_depth--;
-            }
-            release_at.erase(time);
             IE_ASSERT(top_depth > 0);
 
             _top_depth = std::max(_top_depth, top_depth);
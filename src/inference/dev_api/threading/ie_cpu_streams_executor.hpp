@@ -20,7 +20,7 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the lock-free queues, one queue per task priority.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -40,8 +40,22 @@ public:
      */
     ~CPUStreamsExecutor() override;
 
+    /**
+     * @brief Executes the task with the NORMAL priority
+     * @param task A task to start
+     */
     void run(Task task) override;
 
+    /**
+     * @brief Executes the task with the given priority.
+     *        The streams take the tasks with the higher priority first, the tasks of the same priority are taken in
+     *        the FIFO order. A task which is already executed is not preempted.
+     *        The priority is ignored if the executor has no streams, the task is executed in the calling thread.
+     * @param task A task to start
+     * @param priority The task priority
+     */
+    void runWithPriority(Task task, TaskPriority priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -50,6 +50,11 @@ public:
      */
     using Ptr = std::shared_ptr<ITaskExecutor>;
 
+    /**
+     * @brief Priority of a task in the executor queue
+     */
+    enum class TaskPriority { LOW = 0, NORMAL = 1, HIGH = 2 };
+
     /**
      * @brief      Destroys the object.
      */
@@ -74,6 +79,15 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void runAndWait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Execute InferenceEngine::Task with the given priority.
+     *        The executors with a task queue take the tasks with the higher priority first.
+     *        Default implementation ignores the priority and calls run(), so the tasks are executed in FIFO order.
+     * @param task A task to start
+     * @param priority The task priority
+     */
+    virtual void runWithPriority(Task task, TaskPriority priority);
 };
 
 }  // namespace InferenceEngine
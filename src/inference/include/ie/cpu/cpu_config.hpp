@@ -42,5 +42,27 @@ DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
 DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
 
+/**
+ * @brief The name for enabling inter-op parallel execution of independent graph branches on CPU
+ *
+ * When enabled, the CPU plugin groups the nodes of a static graph into stages of mutually independent
+ * nodes (according to the data dependencies) and executes the branches of a stage concurrently inside
+ * the stream. It is useful for multi-branch models in the latency mode, when a single node can not
+ * utilize all the cores of the stream.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(INTER_OP_PARALLEL);
+
+/**
+ * @brief The name for enabling the huge pages for the memory of the dynamic shape tensors on CPU
+ *
+ * When enabled, the big memory blocks of the tensors, whose size is known only at the inference time, are backed by
+ * the transparent huge pages (if supported by the OS), which reduces the page faults and TLB misses.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(HUGE_PAGES);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
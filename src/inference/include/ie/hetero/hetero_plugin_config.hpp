@@ -34,5 +34,14 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of the subgraphs. Every subgraph gets a pool of the given number
+ * of infer requests shared by all infer requests of the network, so a subgraph starts the next inference while the
+ * following subgraphs still process the previous ones. The infer requests that don't find a free subgraph request
+ * wait for one in order of arrival. The value is a number, "0" (default) disables the pipeline and every infer
+ * request runs its own subgraph requests one after another.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -294,6 +294,13 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: CONFIG_VALUE(YES) to compile the network also for the power of two batch sizes
+ * below the device batch, so the batches not filled within the timeout are executed as the smaller batches instead of
+ * the one by one execution. The default is CONFIG_VALUE(NO), as every extra batch size costs the compilation time and
+ * the device memory
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
@@ -26,4 +26,13 @@ class OPENVINO_RUNTIME_API Busy : public Exception {
     using Exception::Exception;
 };
 
+/**
+ * @brief Thrown in case the inference request was dropped because its deadline (ov::hint::request_deadline)
+ * expired before the execution.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API DeadlineExceeded : public Exception {
+    using Exception::Exception;
+};
+
 }  // namespace ov
@@ -49,5 +49,100 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether independent branches of the model are executed concurrently.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Nodes of a static graph are grouped into stages of mutually independent nodes, the branches of each stage
+ * are executed in parallel inside the stream. Per-branch timings are reported with the profiling information.
+ * The following code enables inter-op parallel execution
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::inter_op_parallel(true));
+ * @endcode
+ */
+static constexpr Property<bool> inter_op_parallel{"CPU_INTER_OP_PARALLEL"};
+
+/**
+ * @brief Read-only property to get the lookup statistics of the runtime cache of a compiled model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The runtime cache keeps the primitives and kernels created for the particular shapes, it is shared by all
+ * the streams of the compiled model. The map contains the number of cache "HITS", "MISSES" and "EVICTIONS"
+ * accumulated since the model compilation and may be used to tune the cache capacity. The "SHAPE_INFER_HITS" and
+ * "SHAPE_INFER_MISSES" values are the lookups of the output shapes of the dynamic model by its input shapes, summed
+ * over the streams.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::runtime_cache_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the memory plan of a compiled model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The intermediate tensors with static shapes are placed into a single memory workspace of each stream. The map
+ * contains the "PLANNED_BYTES" workspace size allocated by the memory planner and the "LOWER_BOUND_BYTES" size which
+ * no plan can go below (the maximal total size of the tensors alive at the same time). It may be used to estimate
+ * the memory required for additional streams.
+ *
+ * @code
+ * auto plan = compiled_model.get_property(ov::intel_cpu::memory_plan_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_plan_statistics{
+    "CPU_MEMORY_PLAN_STATISTICS"};
+
+/**
+ * @brief This property defines whether the memory of the dynamic shape tensors is backed by the huge pages.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The big memory blocks of the tensors, whose size is known only at the inference time, are backed by the transparent
+ * huge pages (if supported by the OS) to reduce the page faults and TLB misses.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::huge_pages(true));
+ * @endcode
+ */
+static constexpr Property<bool> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief Read-only property to get the statistics of the memory pools of the dynamic shape tensors.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The memory of the tensors, whose size is known only at the inference time, is taken from the per-stream pools.
+ * The map contains the values summed over the streams: the number of the blocks allocated from the system
+ * ("ALLOCATIONS"), taken from the pool ("REUSES"), the number of the tensor memory reallocations caused by the shape
+ * growth ("REALLOCATIONS"), the peak size of the memory in use ("PEAK_BYTES") and the size of the memory retained
+ * in the pools ("RETAINED_BYTES").
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::dynamic_memory_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> dynamic_memory_statistics{
+    "CPU_DYNAMIC_MEMORY_STATISTICS"};
+
+/**
+ * @brief Read-only property to get how much of an imported model was restored from the compilation results
+ * stored in it.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The map contains the values summed over the streams: the number of the nodes whose primitive implementation was
+ * selected as in the original compilation ("RESTORED_IMPL_TYPES"), the number of the prepared constant tensors
+ * (e.g. reordered weights) copied from the model ("RESTORED_CONSTANTS") and the number of the constant nodes
+ * which were not executed because of that ("SKIPPED_CONSTANT_NODES"). All the values are zero for a model which
+ * was compiled rather than imported.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::import_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> import_statistics{
+    "CPU_IMPORT_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "openvino/core/any.hpp"
+#include "openvino/core/compilation_profile.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/common.hpp"
 
@@ -297,6 +298,23 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief Priority of the inference request among the requests executed by the same streams executor.
+ * The waiting requests with the higher priority are executed first, the running ones are not preempted.
+ * Set via ov::InferRequest::set_property, the default is ov::hint::Priority::MEDIUM.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief Deadline of the inference request in milliseconds, counted from the ov::InferRequest::start_async or
+ * ov::InferRequest::infer call. The request which has not started its execution stage before the deadline is dropped
+ * and completed with the ov::DeadlineExceeded exception. Zero (default) means no deadline.
+ * Set via ov::InferRequest::set_property.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -428,6 +446,32 @@ static constexpr Property<ExecutionMode> execution_mode{"EXECUTION_MODE_HINT"};
  */
 static constexpr Property<bool> enable_profiling{"PERF_COUNT"};
 
+/**
+ * @brief The compile_model property to collect the compilation profile of the model
+ * value type: boolean
+ *   - True the time spent in the compilation stages (frontend conversion when the model is compiled from a file,
+ *     transformation passes with their matcher hits, plugin graph initialization, primitive creation and weights
+ *     reorders) is recorded, the report is available from the `ov::compilation_profile` compiled model property
+ *   - False (default) the profile is not collected
+ * @note The property is handled by the core and isn't passed to the plugins
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool> enable_compilation_profile{"ENABLE_COMPILATION_PROFILE"};
+
+/**
+ * @brief Read-only property to get the compilation profile of a compiled model
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The profile is empty unless the model is compiled with `ov::enable_compilation_profile(true)`. Stages which are
+ * executed lazily (e.g. a graph created for a stream on the first inference) are added when they finish.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model_path, "CPU", ov::enable_compilation_profile(true));
+ * std::cout << compiled_model.get_property(ov::compilation_profile).to_json();
+ * @endcode
+ */
+static constexpr Property<CompilationProfile, PropertyMutability::RO> compilation_profile{"COMPILATION_PROFILE"};
+
 /**
  * @brief Namespace with log level property and its possible values
  */
@@ -571,6 +615,15 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to compile the model for the auto-batching also with the power of two batch sizes below
+ * the selected one, so the batches not filled within the timeout are executed as the smaller batches instead of the
+ * request by request execution. Disabled by default, as every extra batch size costs the compilation time and the
+ * device memory
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -593,6 +646,17 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to enable memory mapping of the model weights file on read_model
+ * value type: boolean
+ *   - True the weights file is mapped to the memory and the model constants are created as views of the mapping,
+ *     the pages are copied only if the constant data is modified (copy-on-write)
+ *   - False (default) the whole weights file is read to the heap memory
+ * @note Supported for OpenVINO IR weights and ONNX external data files
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -4,6 +4,7 @@
 
 #include "compilation_context.hpp"
 
+#include <algorithm>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -16,9 +17,12 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
@@ -53,6 +57,47 @@ uint64_t calculate_td(const InferenceEngine::TensorDesc& td, uint64_t _seed) {
     return seed;
 }
 
+struct DataChunk {
+    const uint8_t* data;
+    size_t size;
+};
+
+/**
+ * @brief Calculates hash of the sequence of buffers.
+ * The buffers are split into the chunks of fixed size which are hashed in parallel, so the result doesn't depend on
+ * the number of threads. Unlike the serial word-by-word hash_combine, the throughput is limited by the memory bandwidth.
+ */
+uint64_t calculate_buffers_hash(const std::vector<DataChunk>& buffers) {
+    constexpr size_t chunk_size = 1 << 20;
+    std::vector<DataChunk> chunks;
+    for (const auto& buffer : buffers) {
+        // an empty buffer is still a chunk, so the buffer boundaries affect the hash
+        size_t offset = 0;
+        do {
+            chunks.push_back({buffer.data + offset, std::min(chunk_size, buffer.size - offset)});
+            offset += chunk_size;
+        } while (offset < buffer.size);
+    }
+
+    std::vector<uint64_t> hashes(chunks.size());
+    InferenceEngine::parallel_for(chunks.size(), [&](size_t i) {
+        hashes[i] = ov::util::xxh64(chunks[i].data, chunks[i].size, chunks[i].size);
+    });
+    return ov::util::xxh64(hashes.data(), hashes.size() * sizeof(uint64_t), 0);
+}
+
+void collect_constants_data(const std::shared_ptr<const ov::Model>& model, std::vector<DataChunk>& buffers) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<const ov::op::v0::Constant>(op)) {
+            buffers.push_back({static_cast<const uint8_t*>(constant->get_data_ptr()), constant->get_byte_size()});
+        } else if (const auto sub_graph = std::dynamic_pointer_cast<const ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < sub_graph->get_internal_subgraphs_size(); i++) {
+                collect_constants_data(sub_graph->get_function(i), buffers);
+            }
+        }
+    }
+}
+
 }  // namespace
 
 namespace ov {
@@ -86,12 +131,16 @@ std::string NetworkCompilationContext::compute_hash(const std::shared_ptr<const
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function, the data of constants is hashed separately in parallel
     ov::pass::Manager m;
     m.register_pass<ov::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, false);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
+    std::vector<DataChunk> constants;
+    collect_constants_data(model, constants);
+    seed = ov::hash_combine(seed, calculate_buffers_hash(constants));
+
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = ov::hash_combine(seed, kvp.first + kvp.second.as<std::string>());
@@ -172,16 +221,8 @@ std::string NetworkCompilationContext::compute_hash(const std::string& modelStr,
     // tensor data
     if (tensor) {
         seed = hash_combine(seed, tensor.get_size());
-
-        auto ptr = static_cast<size_t*>(tensor.data());
-        size_t size = tensor.get_size() / sizeof(size_t);
-        for (size_t i = 0; i < size; i++)
-            seed = hash_combine(seed, ptr[i]);
-        auto size_done = size * sizeof(size_t);
-        auto ptr_left = static_cast<uint8_t*>(tensor.data()) + size_done;
-        size_t size_left = tensor.get_size() - size_done;
-        for (size_t i = 0; i < size_left; i++)
-            seed = hash_combine(seed, ptr_left[i]);
+        const auto data = static_cast<const uint8_t*>(tensor.data());
+        seed = hash_combine(seed, calculate_buffers_hash({{data, tensor.get_byte_size()}}));
     }
 
     // compile options
@@ -54,6 +54,8 @@ namespace InferenceEngine {
         __VA_ARGS__;                                                        \
     } catch (const ::InferenceEngine::RequestBusy& ex) {                    \
         throw ov::Busy(ex.what());                                          \
+    } catch (const ov::DeadlineExceeded&) {                                 \
+        throw;                                                              \
     } catch (const std::exception& ex) {                                    \
         throw ov::Exception(ex.what());                                     \
     } catch (...) {                                                         \
@@ -477,6 +479,8 @@ void InferRequest::wait() {
         _impl->Wait(ie::InferRequest::RESULT_READY);
     } catch (const ie::InferCancelled& e) {
         throw Cancelled{e.what()};
+    } catch (const DeadlineExceeded&) {
+        throw;
     } catch (const std::exception& ex) {
         throw Exception(ex.what());
     } catch (...) {
@@ -490,6 +494,8 @@ bool InferRequest::wait_for(const std::chrono::milliseconds timeout) {
         return _impl->Wait(timeout.count()) == ie::OK;
     } catch (const ie::InferCancelled& e) {
         throw Cancelled{e.what()};
+    } catch (const DeadlineExceeded&) {
+        throw;
     } catch (const std::exception& ex) {
         throw Exception(ex.what());
     } catch (...) {
@@ -501,6 +507,14 @@ void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback
     OV_INFER_REQ_CALL_STATEMENT(_impl->SetCallback(std::move(callback));)
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetProperties(properties);)
+}
+
+Any InferRequest::get_property(const std::string& name) const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->GetProperty(name);)
+}
+
 std::vector<VariableState> InferRequest::query_state() {
     std::vector<VariableState> variable_states;
     std::vector<std::shared_ptr<void>> soVec;
@@ -454,6 +454,31 @@ void IInferRequestInternal::SetCallback(Callback callback) {
     _callback = std::move(callback);
 }
 
+void IInferRequestInternal::SetProperties(const ov::AnyMap& properties) {
+    for (auto&& property : properties) {
+        if (property.first == ov::hint::request_priority.name()) {
+            _priority = property.second.as<ov::hint::Priority>();
+        } else if (property.first == ov::hint::request_deadline.name()) {
+            _deadline = std::chrono::milliseconds{property.second.as<uint32_t>()};
+        } else {
+            IE_THROW(NotFound) << "Unsupported infer request property: " << property.first;
+        }
+    }
+}
+
+ov::Any IInferRequestInternal::GetProperty(const std::string& name) const {
+    if (name == ov::hint::request_priority.name()) {
+        return _priority;
+    } else if (name == ov::hint::request_deadline.name()) {
+        return static_cast<uint32_t>(_deadline.count());
+    } else if (name == ov::supported_properties.name()) {
+        return std::vector<ov::PropertyName>{
+            ov::PropertyName{ov::hint::request_priority.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::hint::request_deadline.name(), ov::PropertyMutability::RW}};
+    }
+    IE_THROW(NotFound) << "Unsupported infer request property: " << name;
+}
+
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
@@ -21,6 +21,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/core/compilation_profile.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/op_extension.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
@@ -53,6 +54,20 @@ void stripDeviceName(std::string& device, const std::string& substr) {
     }
 }
 
+// The compilation profile is collected on the compiling thread, the plugins take the active profile from there.
+// The property is removed from the config since the plugins don't know it.
+std::unique_ptr<ov::CompilationProfile::Scope> start_compilation_profile(ov::AnyMap& config) {
+    auto it = config.find(ov::enable_compilation_profile.name());
+    if (it == config.end())
+        return {};
+    const auto enable = it->second.as<bool>();
+    config.erase(it);
+    if (!enable)
+        return {};
+    return std::unique_ptr<ov::CompilationProfile::Scope>(
+        new ov::CompilationProfile::Scope(std::make_shared<ov::CompilationProfile>()));
+}
+
 }  // namespace
 
 ov::CoreImpl::CoreImpl(bool _newAPI) : m_new_api(_newAPI) {
@@ -258,9 +273,11 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::compile_model::model");
     std::string deviceName = device_name;
     ov::AnyMap config_with_batch = config;
+    const auto profile_scope = start_compilation_profile(config_with_batch);
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
     apply_auto_batching(model, deviceName, config_with_batch);
     clean_properties(deviceName, config_with_batch, ov::auto_batch_timeout);
+    clean_properties(deviceName, config_with_batch, ov::auto_batch_partial_batches);
 
     bool forceDisableCache = config_with_batch.count(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE)) > 0;
     auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch);
@@ -299,11 +316,13 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     }
     // have to deduce the device name/config from the context first
     auto parsed = parseDeviceNameIntoConfig(context.get_device_name(), config);
+    const auto profile_scope = start_compilation_profile(parsed._config);
     std::string& deviceName = parsed._deviceName;
     auto& config_with_batch = parsed._config;
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
     apply_auto_batching(model, deviceName, config_with_batch);
     clean_properties(deviceName, config_with_batch, ov::auto_batch_timeout);
+    clean_properties(deviceName, config_with_batch, ov::auto_batch_partial_batches);
     parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch);
 
     auto plugin = get_plugin(parsed._deviceName);
@@ -356,6 +375,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::compile_model::Path");
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
+    const auto profile_scope = start_compilation_profile(parsed._config);
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
     auto cacheManager =
@@ -387,6 +407,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
+    const auto profile_scope = start_compilation_profile(parsed._config);
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
 
@@ -644,6 +665,9 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::hint::allow_auto_batching.name()) {
         const auto flag = coreConfig.flag_allow_auto_batching;
         return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+    } else if (name == ov::enable_mmap.name()) {
+        const auto flag = coreConfig.flag_enable_mmap;
+        return decltype(ov::enable_mmap)::value_type(flag);
     }
 
     OPENVINO_UNREACHABLE("Exception is thrown while trying to call get_property with unsupported property: '",
@@ -1008,6 +1032,13 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         flag_allow_auto_batching = flag;
         config.erase(it);
     }
+
+    it = config.find(ov::enable_mmap.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        flag_enable_mmap = flag;
+        config.erase(it);
+    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
@@ -97,6 +97,8 @@ private:
 
         bool flag_allow_auto_batching = true;
 
+        bool flag_enable_mmap = false;
+
         void set_and_update(ov::AnyMap& config);
 
         void set_cache_dir_for_device(const std::string& dir, const std::string& name);
@@ -4,6 +4,7 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <climits>
@@ -22,6 +23,7 @@
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
+#include "threading/ie_thread_safe_containers.hpp"
 
 using namespace openvino;
 
@@ -280,15 +282,15 @@ struct CPUStreamsExecutor::Impl {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    if (!TryPop(task)) {
+                        // the mutex is taken only if the queues are empty and the stream is going to sleep
                         std::unique_lock<std::mutex> lock(_mutex);
+                        _sleepingStreams.fetch_add(1);
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return TryPop(task) || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        _sleepingStreams.fetch_sub(1);
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -298,12 +300,28 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    bool TryPop(Task& task) {
+        // the queues are ordered from the highest priority to the lowest one
+        for (auto& queue : _taskQueues) {
+            if (queue.try_pop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Enqueue(Task task, TaskPriority priority) {
+        _taskQueues[static_cast<std::size_t>(TaskPriority::HIGH) - static_cast<std::size_t>(priority)].push(
+            std::move(task));
+        // pairs with the fence in the stream loop: either the sleeping stream is counted here, or it sees the task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepingStreams.load() > 0) {
+            // the stream counted as sleeping may have not started waiting yet, so the mutex is taken before notify
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -342,7 +360,8 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::array<ThreadSafeQueue<Task>, static_cast<std::size_t>(TaskPriority::HIGH) + 1> _taskQueues;
+    std::atomic<int> _sleepingStreams{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -388,10 +407,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    runWithPriority(std::move(task), TaskPriority::NORMAL);
+}
+
+void CPUStreamsExecutor::runWithPriority(Task task, TaskPriority priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
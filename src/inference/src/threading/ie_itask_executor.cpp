@@ -35,4 +35,8 @@ void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
         future.get();
     }
 }
+
+void ITaskExecutor::runWithPriority(Task task, TaskPriority) {
+    run(std::move(task));
+}
 }  // namespace InferenceEngine
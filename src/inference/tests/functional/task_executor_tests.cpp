@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <chrono>
 #include <future>
 #include <ie_parallel.hpp>
 #include <thread>
@@ -47,6 +48,19 @@ TEST_P(TaskExecutorTests, canRunCustomFunction) {
     ASSERT_NO_THROW(f.get());
 }
 
+TEST_P(TaskExecutorTests, canRunFunctionWithPriority) {
+    auto taskExecutor = GetParam()();
+    auto p = std::make_shared<std::packaged_task<void()>>([] {});
+    auto f = p->get_future();
+    taskExecutor->runWithPriority(
+        [p] {
+            (*p)();
+        },
+        ITaskExecutor::TaskPriority::HIGH);
+    f.wait();
+    ASSERT_NO_THROW(f.get());
+}
+
 TEST_P(TaskExecutorTests, canRun2FunctionsOneByOne) {
     auto taskExecutor = GetParam()();
     std::mutex m;
@@ -214,6 +228,80 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, tasksAreTakenInPriorityOrder) {
+    CPUStreamsExecutor executor{
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+    std::promise<void> unblock;
+    auto unblockFuture = unblock.get_future().share();
+    std::promise<void> started;
+    // occupy the only stream, so the next tasks are queued
+    executor.run([&] {
+        started.set_value();
+        unblockFuture.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    auto run = [&](int id, CPUStreamsExecutor::TaskPriority priority) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, id] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(id);
+        });
+        futures.emplace_back(p->get_future());
+        executor.runWithPriority(
+            [p] {
+                (*p)();
+            },
+            priority);
+    };
+    run(0, CPUStreamsExecutor::TaskPriority::LOW);
+    run(1, CPUStreamsExecutor::TaskPriority::NORMAL);
+    run(2, CPUStreamsExecutor::TaskPriority::HIGH);
+    run(3, CPUStreamsExecutor::TaskPriority::NORMAL);
+    run(4, CPUStreamsExecutor::TaskPriority::HIGH);
+    unblock.set_value();
+
+    for (auto& f : futures)
+        f.wait();
+    ASSERT_EQ(order, (std::vector<int>{2, 4, 1, 3, 0}));
+}
+
+// Measures the scheduling overhead: the time from the submission of an empty task to its completion
+TEST(CPUStreamsExecutorTests, schedulingOverheadPerTask) {
+    const int streams = std::max(1, getNumberOfCPUCores());
+    const int submitters = streams;
+    const int tasksPerSubmitter = 20000;
+    CPUStreamsExecutor executor{
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+
+    std::atomic_int done{0};
+    std::promise<void> allDone;
+    const int total = submitters * tasksPerSubmitter;
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < submitters; i++) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < tasksPerSubmitter; k++) {
+                executor.run([&] {
+                    if (++done == total)
+                        allDone.set_value();
+                });
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    allDone.get_future().wait();
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "CPUStreamsExecutor scheduling overhead: " << duration / total << " ns per task (" << streams
+              << " streams, " << submitters << " submitting threads)" << std::endl;
+    ASSERT_EQ(total, done);
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -8,7 +8,10 @@
 #include <cpp/ie_infer_async_request_base.hpp>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include <deque>
+#include <future>
 #include <inference_engine.hpp>
+#include <mutex>
+#include <thread>
 #include <threading/ie_cpu_streams_executor.hpp>
 
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_async_infer_request_default.hpp"
@@ -189,3 +192,103 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// Request properties
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetProperties) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetProperties({ov::hint::request_priority(ov::hint::Priority::HIGH)}), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canSetAndGetProperties) {
+    ASSERT_NO_THROW(testRequest->SetProperties(
+        {ov::hint::request_priority(ov::hint::Priority::LOW), ov::hint::request_deadline(100)}));
+    ASSERT_EQ(ov::hint::Priority::LOW,
+              testRequest->GetProperty(ov::hint::request_priority.name()).as<ov::hint::Priority>());
+    ASSERT_EQ(100u, testRequest->GetProperty(ov::hint::request_deadline.name()).as<uint32_t>());
+    ASSERT_THROW(testRequest->SetProperties({{"UNSUPPORTED_PROPERTY", 1}}), NotFound);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredRequestIsDroppedBeforeExecution) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->SetProperties({ov::hint::request_deadline(1)});
+    std::exception_ptr exceptionPtr;
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr_) {
+        exceptionPtr = exceptionPtr_;
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    taskExecutor->executeAll();
+    EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), ov::DeadlineExceeded);
+    ASSERT_NE(nullptr, exceptionPtr);
+    EXPECT_THROW(std::rethrow_exception(exceptionPtr), ov::DeadlineExceeded);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, requestInTimeIsNotDropped) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->SetProperties({ov::hint::request_deadline(60000)});
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, startedRequestIsNotDroppedAfterDeadline) {
+    struct TwoStagesAsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+        TwoStagesAsyncInferRequest(const IInferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& taskExecutor)
+            : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskExecutor) {
+            // the first stage outlives the deadline, the inference stage is still executed
+            _pipeline.insert(_pipeline.begin(), {taskExecutor, [] {
+                                                     std::this_thread::sleep_for(std::chrono::milliseconds{100});
+                                                 }});
+        }
+        ~TwoStagesAsyncInferRequest() override {
+            StopAndWait();
+        }
+    };
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TwoStagesAsyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    testRequest->SetProperties({ov::hint::request_deadline(50)});
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, highPriorityRequestIsExecutedFirst) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestRequestPriority", 1});
+    std::promise<void> started, unblock;
+    auto unblockFuture = unblock.get_future().share();
+    taskExecutor->run([&started, unblockFuture] {
+        started.set_value();
+        unblockFuture.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<shared_ptr<MockIInferRequestInternal>> syncRequests;
+    std::vector<shared_ptr<AsyncInferRequestThreadSafeDefault>> requests;
+    for (auto priority : {ov::hint::Priority::LOW, ov::hint::Priority::MEDIUM, ov::hint::Priority::HIGH}) {
+        const int id = static_cast<int>(priority);
+        syncRequests.push_back(make_shared<MockIInferRequestInternal>(InputsDataMap{}, OutputsDataMap{}));
+        EXPECT_CALL(*syncRequests.back(), InferImpl()).WillOnce(Invoke([&, id] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(id);
+        }));
+        requests.push_back(make_shared<AsyncInferRequestThreadSafeDefault>(syncRequests.back(), taskExecutor, nullptr));
+        requests.back()->SetProperties({ov::hint::request_priority(priority)});
+        requests.back()->StartAsync();
+    }
+    unblock.set_value();
+
+    for (auto& request : requests)
+        ASSERT_EQ(OK, request->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(order, (std::vector<int>{2, 1, 0}));
+}
@@ -17,6 +17,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -308,6 +309,47 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(NetworkCompilationContext::compute_hash(net2, {}), NetworkCompilationContext::compute_hash(net3, {}));
 }
 
+static std::shared_ptr<ngraph::Function> create_function_with_weights(const std::vector<float>& weights) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, weights.size()});
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, weights.size()}, weights);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+static std::shared_ptr<ngraph::Function> create_function_with_body(const std::vector<float>& weights) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{2, weights.size()});
+    auto body = create_function_with_weights(weights);
+    auto tensor_iterator = std::make_shared<ngraph::opset6::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(body->get_parameters().front(), data, 0, 1, 1, -1, 0);
+    auto out = tensor_iterator->get_concatenated_slices(body->get_results().front(), 0, 1, 1, -1, 0);
+    auto res = std::make_shared<ngraph::opset6::Result>(out);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithConstantData) {
+    // the data is bigger than the hashing chunk, so the change in the tail chunk must be detected as well
+    std::vector<float> weights(600 * 1024);
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = static_cast<float>(i % 251);
+    }
+    auto modified = weights;
+    modified.back() += 1.f;
+
+    ASSERT_EQ(NetworkCompilationContext::compute_hash(create_function_with_weights(weights), {}),
+              NetworkCompilationContext::compute_hash(create_function_with_weights(weights), {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash(create_function_with_weights(weights), {}),
+              NetworkCompilationContext::compute_hash(create_function_with_weights(modified), {}));
+}
+
+TEST(NetworkContext, HashWithConstantDataInBody) {
+    ASSERT_EQ(NetworkCompilationContext::compute_hash(create_function_with_body({1.f, 2.f}), {}),
+              NetworkCompilationContext::compute_hash(create_function_with_body({1.f, 2.f}), {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash(create_function_with_body({1.f, 2.f}), {}),
+              NetworkCompilationContext::compute_hash(create_function_with_body({1.f, 3.f}), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_function();
@@ -370,3 +412,27 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
     ASSERT_EQ(NetworkCompilationContext::compute_hash(file1, {{"key", "value"}}),
               NetworkCompilationContext::compute_hash(file2, {{"key", "value"}}));
 }
+
+////////////////////////////////////////////
+
+TEST(NetworkContext_ModelMemory, HashOfSame) {
+    std::vector<uint8_t> weights((1 << 20) * 2 + 3);
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = static_cast<uint8_t>(i * 7);
+    }
+    auto copy = weights;
+    auto modified = weights;
+    modified[weights.size() / 2] ^= 1;
+    ov::Tensor tensor(ov::element::u8, {weights.size()}, weights.data());
+    ov::Tensor copy_tensor(ov::element::u8, {copy.size()}, copy.data());
+    ov::Tensor modified_tensor(ov::element::u8, {modified.size()}, modified.data());
+
+    ASSERT_EQ(NetworkCompilationContext::compute_hash("model", tensor, {}),
+              NetworkCompilationContext::compute_hash("model", copy_tensor, {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash("model", tensor, {}),
+              NetworkCompilationContext::compute_hash("model", modified_tensor, {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash("model", tensor, {}),
+              NetworkCompilationContext::compute_hash("model2", tensor, {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash("model", tensor, {}),
+              NetworkCompilationContext::compute_hash("model", ov::Tensor(), {}));
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <ie_common.h>
 
+#include <random>
 #include <vector>
 
 using Box = MemorySolver::Box;
@@ -337,3 +338,78 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+//  |            __________
+//  |   ____    |_3________|
+//  |  |_4__|_____ |    |
+//  |__|_2________||_1__|___
+//      2  3  4  5  6  7  8
+TEST(MemSolverTest, BestOfHeuristicsEfficiency) {
+    std::vector<Box> boxes{
+        {6, 7, 3},
+        {2, 5, 2},
+        {5, 8, 2},
+        {2, 3, 2},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::BEST_OF_HEURISTICS), 5);
+    EXPECT_EQ(ms.maxDepth(), 5);
+}
+
+TEST(MemSolverTest, BestOfHeuristicsNoOverlapping) {
+    int n = 0;
+    std::vector<Box> boxes{
+        {4, 8, 1, n++},
+        {6, 7, 3, n++},
+        {2, 3, 3, n++},
+        {2, 4, 2, n++},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::BEST_OF_HEURISTICS), 5);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int64_t off1 = ms.getOffset(static_cast<int>(box1.id));
+        int64_t off2 = ms.getOffset(static_cast<int>(box2.id));
+        return box1.finish < box2.start || box1.start > box2.finish || off1 + box1.size <= off2 ||
+               off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, BestOfHeuristicsIsNotWorseThanGreedy) {
+    std::mt19937 gen(42);
+    for (int iter = 0; iter < 100; iter++) {
+        std::vector<Box> boxes;
+        const int n = 1 + static_cast<int>(gen() % 50);
+        for (int i = 0; i < n; i++) {
+            const int start = static_cast<int>(gen() % 30);
+            const int finish = start + static_cast<int>(gen() % 8);
+            boxes.push_back({start, finish, static_cast<int64_t>(1 + gen() % 100), i});
+        }
+
+        MemorySolver greedy(boxes);
+        MemorySolver best(boxes);
+        const int64_t greedy_size = greedy.solve();
+        const int64_t best_size = best.solve(MemorySolver::Strategy::BEST_OF_HEURISTICS);
+        ASSERT_LE(best_size, greedy_size);
+        ASSERT_GE(best_size, best.maxDepth());
+
+        for (int i = 0; i < n; i++) {
+            const auto& box1 = boxes[i];
+            const int64_t off1 = best.getOffset(i);
+            ASSERT_LE(off1 + box1.size, best_size);
+            for (int j = i + 1; j < n; j++) {
+                const auto& box2 = boxes[j];
+                const int64_t off2 = best.getOffset(j);
+                ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish || off1 + box1.size <= off2 ||
+                            off1 >= off2 + box2.size)
+                    << "Box overlapping is detected";
+            }
+        }
+    }
+}
@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -29,6 +30,7 @@ using namespace InferenceEngine;
 
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES),
                                                  CONFIG_KEY(CACHE_DIR)};
 
 template <Precision::ePrecision precision>
@@ -332,16 +334,22 @@ void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& re
 }
 
 void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    CopyInputsToRequest(_myBatchedRequestWrapper._inferRequestBatched, _batchId, _batchSize);
+}
+
+void AutoBatchInferRequest::CopyInputsToRequest(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batchId, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -349,13 +357,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -364,10 +372,14 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
 }
 
 void AutoBatchInferRequest::CopyOutputsIfNeeded() {
+    CopyOutputsFromRequest(_myBatchedRequestWrapper._inferRequestBatched, _batchId, _batchSize);
+}
+
+void AutoBatchInferRequest::CopyOutputsFromRequest(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batchId, batchSize);
     }
 }
 
@@ -386,10 +398,24 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
-            workerInferRequest._tasks.push(t);
-            // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
-            const int sz = static_cast<int>(workerInferRequest._tasks.size());
-            if (sz == workerInferRequest._batchSize) {
+            int sz = 0;
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                const auto now = std::chrono::steady_clock::now();
+                if (workerInferRequest._lastArrival != std::chrono::steady_clock::time_point{}) {
+                    const double gap =
+                        std::chrono::duration<double, std::milli>(now - workerInferRequest._lastArrival).count();
+                    auto& mean = workerInferRequest._meanInterArrival;
+                    mean = mean == 0.0 ? gap : 0.875 * mean + 0.125 * gap;
+                }
+                workerInferRequest._lastArrival = now;
+                workerInferRequest._arrivals.push_back(now);
+                workerInferRequest._tasks.push(t);
+                // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
+                sz = static_cast<int>(workerInferRequest._tasks.size());
+            }
+            // the first request of the batch starts the (adaptive) timeout, the last one completes the batch
+            if (sz == workerInferRequest._batchSize || sz == 1) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -402,6 +428,7 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                       if (batchReq._exceptionPtr)  // when the batchN execution failed
                           std::rethrow_exception(batchReq._exceptionPtr);
                       // in the case of non-batched execution the blobs were set explicitly
+                      // in the case of the partial batch the outputs were copied on the completion
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                           this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
@@ -413,6 +440,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_partialBatchedRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -429,6 +458,7 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForPartialBatches,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
@@ -437,6 +467,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksPartial{networksForPartialBatches},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -450,6 +481,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
     _terminate = true;
     for (auto w : _workerRequests) {
+        w->_cond.notify_one();
         w->_thread.join();
     }
     _workerRequests.clear();
@@ -517,18 +549,30 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 workerRequestPtr->_cond.notify_one();
             });
 
+        for (const auto& partial : _networksPartial) {
+            workerRequestPtr->_inferRequestsPartial[partial.first] = {partial.second->CreateInferRequest(),
+                                                                      partial.second._so};
+        }
+
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
             while (1) {
-                std::cv_status status;
+                bool timeToExecute = false;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    // as we pop the tasks from the queue only here
+                    // it is ok to call size() (as the _tasks can only grow in parallel)
+                    auto waitTime =
+                        GetBatchWaitTime(*workerRequestPtr, static_cast<int>(workerRequestPtr->_tasks.size()));
+                    if (waitTime.count() > 0) {
+                        workerRequestPtr->_cond.wait_for(lock, waitTime);
+                        waitTime =
+                            GetBatchWaitTime(*workerRequestPtr, static_cast<int>(workerRequestPtr->_tasks.size()));
+                    }
+                    timeToExecute = waitTime.count() == 0;
                 }
                 if (_terminate) {
                     break;
                 } else {
-                    // as we pop the tasks from the queue only here
-                    // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
@@ -539,30 +583,12 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        PopArrivals(*workerRequestPtr, sz);
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
-                        }
-                        all_completed_future.get();
+                    } else if (timeToExecute && sz) {
+                        // the timeout is over or the batch is not expected to be filled before it,
+                        // so the requests collected by the moment are executed as the smaller batches or with batch1
+                        ExecutePartialBatch(*workerRequestPtr, sz);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -572,6 +598,99 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), static_cast<int>(batch_id)};
 }
 
+std::chrono::microseconds AutoBatchExecutableNetwork::GetBatchWaitTime(const WorkerInferRequest& workerRequest,
+                                                                       int collected) const {
+    const int timeOut = _timeOut;
+    if (!collected)  // nothing to execute, the first request wakes up the worker
+        return std::chrono::milliseconds(std::max(timeOut, 1));
+
+    // the oldest collected request mustn't wait longer than the timeout
+    const auto now = std::chrono::steady_clock::now();
+    const auto deadline = workerRequest._arrivals.front() + std::chrono::milliseconds(timeOut);
+    if (now >= deadline)
+        return std::chrono::microseconds(0);
+    const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+    if (workerRequest._meanInterArrival == 0.0)  // no statistics yet
+        return remaining;
+
+    // the time to collect the rest of the batch at the observed arrival rate (which drops if no requests arrive)
+    const double sinceLastArrival =
+        std::chrono::duration<double, std::milli>(now - workerRequest._lastArrival).count();
+    const double interArrival = std::max(workerRequest._meanInterArrival, sinceLastArrival);
+    const auto expected = std::chrono::microseconds(
+        static_cast<int64_t>(interArrival * 1000.0 * (workerRequest._batchSize - collected)));
+    // no reason to wait if the batch is not expected to be filled in time
+    if (expected > remaining)
+        return std::chrono::microseconds(0);
+    // the expected time is rechecked after the wait, as the rate estimation is updated with the arrivals
+    return std::max(expected, std::chrono::microseconds(100));
+}
+
+void AutoBatchExecutableNetwork::PopArrivals(WorkerInferRequest& workerRequest, int popped) {
+    // the requests arrived while the collected ones were popped keep their arrival times (and so the timeout)
+    std::lock_guard<std::mutex> lock(workerRequest._mutex);
+    workerRequest._arrivals.erase(workerRequest._arrivals.begin(), workerRequest._arrivals.begin() + popped);
+}
+
+void AutoBatchExecutableNetwork::ExecutePartialBatch(WorkerInferRequest& workerRequest, int collected) {
+    using TaskWithRequest = std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>;
+    std::vector<TaskWithRequest> tasks(collected);
+    for (auto& t : tasks)
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+    PopArrivals(workerRequest, collected);
+
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto complete = [collected, &arrived, &all_completed](const TaskWithRequest& t) {
+        t.second();
+        if (collected == ++arrived)
+            all_completed.set_value();
+    };
+
+    int start = 0;
+    while (start < collected) {
+        // the biggest of the smaller batches which can be filled, the rest is executed the same way
+        auto partial = workerRequest._inferRequestsPartial.upper_bound(collected - start);
+        if (partial != workerRequest._inferRequestsPartial.begin()) {
+            --partial;
+            const int batchSize = partial->first;
+            auto& req = partial->second;
+            for (int n = 0; n < batchSize; n++) {
+                auto& inferRequest = tasks[start + n].first->_inferRequest;
+                inferRequest->CopyInputsToRequest(req, n, batchSize);
+                inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                inferRequest->_partialBatchedRequest = req;
+            }
+            req->SetCallback([&tasks, &req, &complete, start, batchSize](std::exception_ptr p) {
+                for (int n = 0; n < batchSize; n++) {
+                    const auto& t = tasks[start + n];
+                    if (p)
+                        t.first->_inferRequest->_exceptionPtr = p;
+                    else
+                        t.first->_inferRequest->CopyOutputsFromRequest(req, n, batchSize);
+                    complete(t);
+                }
+            });
+            req->StartAsync();
+            start += batchSize;
+        } else {
+            // no smaller batch fits, execute with batch1
+            const auto& t = tasks[start];
+            t.first->_inferRequestWithoutBatch->SetCallback([&t, &complete](std::exception_ptr p) {
+                if (p)
+                    t.first->_inferRequest->_exceptionPtr = p;
+                complete(t);
+            });
+            t.first->_inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+            t.first->_inferRequestWithoutBatch->StartAsync();
+            start++;
+        }
+    }
+    all_completed_future.get();
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -773,6 +892,10 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
                 IE_THROW(ParameterMismatch)
                     << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
             }
+        } else if (name == CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)
+                                            << " got " << val;
         }
     }
 }
@@ -790,6 +913,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -959,23 +1083,41 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    auto loadBatchedNetwork = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadBatchedNetwork(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    // the power of two batches below the full one, to execute the partially filled batches without the fallback
+    // to batch1 for each request (opt-in, as each of them is compiled and allocated on the device)
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksPartial;
+    const auto partialBatches = fullConfig.find(CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES));
+    if (executableNetworkWithBatch && partialBatches != fullConfig.end() &&
+        partialBatches->second == CONFIG_VALUE(YES)) {
+        for (int batch = 2; batch < metaDevice.batchForDevice; batch *= 2) {
+            try {
+                executableNetworksPartial[batch] = loadBatchedNetwork(batch);
+            } catch (...) {
+                break;
+            }
+        }
+    }
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        executableNetworksPartial,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
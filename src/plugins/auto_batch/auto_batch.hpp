@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <string>
@@ -43,11 +45,18 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // requests of the networks compiled for the smaller batch sizes, to execute the partially filled batches
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsPartial;
+        // arrival statistics for the adaptive timeout (guarded by the _mutex)
+        std::deque<std::chrono::steady_clock::time_point> _arrivals;  // of the collected requests, in order
+        std::chrono::steady_clock::time_point _lastArrival;
+        double _meanInterArrival = 0.0;  // in ms, exponential moving average
     };
 
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForPartialBatches,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
@@ -73,8 +82,14 @@ protected:
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    // networks for the power of two batch sizes below the _device.batchForDevice (with AUTO_BATCH_PARTIAL_BATCHES)
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksPartial;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    // returns how long to wait for more requests before executing the collected (partial) batch, zero to execute now
+    std::chrono::microseconds GetBatchWaitTime(const WorkerInferRequest& workerRequest, int collected) const;
+    static void PopArrivals(WorkerInferRequest& workerRequest, int popped);
+    void ExecutePartialBatch(WorkerInferRequest& workerRequest, int collected);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
     std::mutex _workerRequestsMutex;
 
@@ -109,16 +124,26 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // copies the data to/from the given slot of a request compiled for another batch size
+    void CopyInputsToRequest(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
+    void CopyOutputsFromRequest(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    // the request of the smaller batch size used for the last PARTIAL_BATCH_EXECUTED inference
+    InferenceEngine::SoIInferRequestInternal _partialBatchedRequest;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
@@ -16,6 +16,10 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    if (_heteroInferRequest->IsPipelined()) {
+        CreatePipelinedStages();
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
@@ -44,11 +48,62 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     }
 }
 
+void HeteroAsyncInferRequest::CreatePipelinedStages() {
+    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
+        // the subgraph request is taken from the pool when the stage starts, the stage waits for a free one
+        struct PooledRequestExecutor : ITaskExecutor {
+            PooledRequestExecutor(const HeteroInferRequest::Ptr& heteroInferRequest, std::size_t requestId)
+                : _heteroInferRequest(heteroInferRequest),
+                  _requestId(requestId) {}
+            void run(Task task) override {
+                _task = std::move(task);
+                _heteroInferRequest->_inferRequests[_requestId]._pool->Acquire(
+                    [this](const SoIInferRequestInternal& inferRequest) {
+                        try {
+                            _heteroInferRequest->BindSubRequest(_requestId, inferRequest);
+                            inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
+                                Complete(exceptionPtr);
+                            });
+                            inferRequest->StartAsync();
+                        } catch (...) {
+                            Complete(std::current_exception());
+                        }
+                    });
+            };
+            void Complete(std::exception_ptr exceptionPtr) {
+                _exceptionPtr = exceptionPtr;
+                if (nullptr != exceptionPtr) {
+                    _heteroInferRequest->ReleaseAllSubRequests();
+                } else {
+                    _heteroInferRequest->ReleaseSubRequests(_requestId);
+                }
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
+            HeteroInferRequest::Ptr _heteroInferRequest;
+            std::size_t _requestId;
+            std::exception_ptr _exceptionPtr;
+            Task _task;
+        };
+
+        auto requestExecutor = std::make_shared<PooledRequestExecutor>(_heteroInferRequest, requestId);
+        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
+            if (nullptr != requestExecutor->_exceptionPtr) {
+                std::rethrow_exception(requestExecutor->_exceptionPtr);
+            }
+        });
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch (...) {
+        // the subgraph requests from the pools are given back once they are done
+        if (_heteroInferRequest->IsPipelined()) {
+            throw;
+        }
         for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
             requestDesc._request->Wait(InferRequest::RESULT_READY);
         }
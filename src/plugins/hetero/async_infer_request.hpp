@@ -23,6 +23,8 @@ public:
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 
 private:
+    void CreatePipelinedStages();
+
     HeteroInferRequest::Ptr _heteroInferRequest;
 };
 
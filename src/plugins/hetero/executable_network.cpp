@@ -499,6 +499,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -653,6 +654,59 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    auto itDepth = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itDepth == _config.end()) {
+        return;
+    }
+    int depth = 0;
+    try {
+        depth = std::stoi(itDepth->second);
+    } catch (...) {
+        depth = -1;
+    }
+    if (depth < 0) {
+        IE_THROW() << "Wrong value " << itDepth->second << " for property key " << HETERO_CONFIG_KEY(PIPELINE_DEPTH)
+                   << ". Expected a non-negative number";
+    }
+    if (depth == 0 || _networks.size() < 2) {
+        return;
+    }
+
+    // the infer requests allocate the network inputs and outputs once, so the subgraphs with dynamic shapes
+    // are inferred one after another as usual
+    auto isDynamic = [](const std::vector<std::shared_ptr<const ov::Node>>& nodes) {
+        return std::any_of(nodes.begin(), nodes.end(), [](const std::shared_ptr<const ov::Node>& node) {
+            return node->get_output_partial_shape(0).is_dynamic();
+        });
+    };
+    for (auto&& network : _networks) {
+        if (isDynamic(network._network->getInputs()) || isDynamic(network._network->getOutputs())) {
+            return;
+        }
+    }
+
+    auto itPerfCount = _config.find(CONFIG_KEY(PERF_COUNT));
+    const bool perfCount = itPerfCount != _config.end() && itPerfCount->second == CONFIG_VALUE(YES);
+    for (auto&& network : _networks) {
+        network._pool =
+            std::make_shared<SubRequestPool>(network._network, static_cast<std::size_t>(depth), perfCount);
+        // the states live in the subgraph requests, they can't be shared between the infer requests of the network
+        bool stateful = false;
+        try {
+            stateful = !network._pool->GetRequests().front()->QueryState().empty();
+        } catch (const InferenceEngine::NotImplemented&) {
+        }
+        if (stateful) {
+            for (auto&& desc : _networks) {
+                desc._pool = nullptr;
+            }
+            return;
+        }
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -794,6 +848,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._pool = subnetwork._pool;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
@@ -807,6 +862,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._pool = subnetwork._pool;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
@@ -832,6 +888,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        result = it->second;
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork config key: " << name;
     }
@@ -851,12 +911,18 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE_DEPTH),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, heteroConfigKeys);
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
         unsigned int value = 0u;
+        // in the pipelined mode every subgraph can infer a pool of requests at the same time
+        if (!_networks.empty() && _networks.front()._pool) {
+            value = static_cast<unsigned int>(_networks.size() * _networks.front()._pool->GetRequests().size());
+            return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
+        }
         for (auto&& desc : _networks) {
             value = std::max(value,
                              desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
@@ -65,11 +65,13 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipeline();
 
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        SubRequestPool::Ptr _pool;
     };
 
     std::vector<NetworkDesc> _networks;
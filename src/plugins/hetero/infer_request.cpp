@@ -7,11 +7,15 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <algorithm>
+#include <blob_factory.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
+#include <future>
 #include <ie_algorithm.hpp>
 #include <map>
 #include <string>
+#include <utility>
 
 #include "itt.hpp"
 
@@ -19,6 +23,61 @@ using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+SubRequestPool::SubRequestPool(const SoExecutableNetworkInternal& network, std::size_t depth, bool perfCount)
+    : _perfCount{perfCount} {
+    for (std::size_t i = 0; i < depth; ++i) {
+        SoIInferRequestInternal request = {network->CreateInferRequest(), network._so};
+        request->setModelInputsOutputs(network->getInputs(), network->getOutputs());
+        _requests.push_back(request);
+    }
+    _freeRequests = _requests;
+}
+
+void SubRequestPool::Acquire(Callback callback) {
+    SoIInferRequestInternal request;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_freeRequests.empty()) {
+            _waiters.emplace_back(std::move(callback));
+            return;
+        }
+        request = _freeRequests.back();
+        _freeRequests.pop_back();
+    }
+    callback(request);
+}
+
+SoIInferRequestInternal SubRequestPool::Acquire() {
+    auto promise = std::make_shared<std::promise<SoIInferRequestInternal>>();
+    auto future = promise->get_future();
+    Acquire([promise](const SoIInferRequestInternal& request) {
+        promise->set_value(request);
+    });
+    return future.get();
+}
+
+void SubRequestPool::Release(const SoIInferRequestInternal& request) {
+    Callback waiter;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_waiters.empty()) {
+            _freeRequests.push_back(request);
+            return;
+        }
+        waiter = std::move(_waiters.front());
+        _waiters.pop_front();
+    }
+    waiter(request);
+}
+
+const std::vector<SoIInferRequestInternal>& SubRequestPool::GetRequests() const {
+    return _requests;
+}
+
+bool SubRequestPool::PerfCount() const {
+    return _perfCount;
+}
+
 HeteroInferRequest::HeteroInferRequest(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
@@ -45,6 +104,11 @@ void HeteroInferRequest::CreateInferRequest(
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
+    if (IsPipelined()) {
+        CreatePipelinedInferRequest(subgraphInputToOutputBlobNames);
+        return;
+    }
+
     auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
@@ -85,7 +149,105 @@ void HeteroInferRequest::CreateInferRequest(
     }
 }
 
+void HeteroInferRequest::CreatePipelinedInferRequest(
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
+    auto intermediateBlobName([&](const std::string& blobName) {
+        auto itName = subgraphInputToOutputBlobNames.find(blobName);
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : blobName;
+    });
+    auto networkBlob([&](const std::string& blobName, const TensorDesc& desc, std::size_t id) {
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        _networkBlobs.emplace(blobName, blob);
+        _subgraphFromBlobName.emplace(blobName, id);
+    });
+
+    // subgraph requests are taken from the pools on inference, so the request owns the network inputs and outputs
+    std::map<std::string, std::pair<std::size_t, std::string>> producers;
+    for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+        for (auto&& outputInfo : _inferRequests[id]._network->GetOutputsInfo()) {
+            if (InferenceEngine::details::contains(_networkOutputs, outputInfo.first)) {
+                networkBlob(outputInfo.first, outputInfo.second->getTensorDesc(), id);
+            } else {
+                producers.emplace(intermediateBlobName(outputInfo.first), std::make_pair(id, outputInfo.first));
+            }
+        }
+    }
+
+    // the outputs of a subgraph are read by the following subgraphs, so its request is held until the last of them
+    // is inferred
+    std::vector<std::size_t> lastConsumer(_inferRequests.size());
+    _subgraphInputs.resize(_inferRequests.size());
+    for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+        lastConsumer[id] = id;
+        for (auto&& inputInfo : _inferRequests[id]._network->GetInputsInfo()) {
+            if (InferenceEngine::details::contains(_networkInputs, inputInfo.first)) {
+                networkBlob(inputInfo.first, inputInfo.second->getTensorDesc(), id);
+            } else {
+                const auto& producer = producers.at(intermediateBlobName(inputInfo.first));
+                _subgraphInputs[id].push_back({inputInfo.first, producer.first, producer.second});
+                lastConsumer[producer.first] = std::max(lastConsumer[producer.first], id);
+            }
+        }
+    }
+    _releasedAfter.resize(_inferRequests.size());
+    for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+        _releasedAfter[lastConsumer[id]].push_back(id);
+    }
+    _heldRequests.resize(_inferRequests.size());
+    _subgraphPerfCounts.resize(_inferRequests.size());
+}
+
+bool HeteroInferRequest::IsPipelined() const {
+    return !_inferRequests.empty() && _inferRequests.front()._pool != nullptr;
+}
+
+void HeteroInferRequest::BindSubRequest(std::size_t id, const SoIInferRequestInternal& request) {
+    _heldRequests[id] = request;
+    for (auto&& blobName : _subgraphFromBlobName) {
+        if (blobName.second == id) {
+            request->SetBlob(blobName.first, _networkBlobs.at(blobName.first));
+        }
+    }
+    for (auto&& input : _subgraphInputs[id]) {
+        request->SetBlob(input._name, _heldRequests[input._producer]->GetBlob(input._producerOutput));
+    }
+}
+
+void HeteroInferRequest::ReleaseSubRequests(std::size_t id) {
+    for (auto&& released : _releasedAfter[id]) {
+        auto request = _heldRequests[released];
+        _heldRequests[released] = {};
+        auto& pool = _inferRequests[released]._pool;
+        if (pool->PerfCount()) {
+            _subgraphPerfCounts[released] = request->GetPerformanceCounts();
+        }
+        pool->Release(request);
+    }
+}
+
+void HeteroInferRequest::ReleaseAllSubRequests() {
+    for (std::size_t id = 0; id < _heldRequests.size(); ++id) {
+        if (_heldRequests[id]) {
+            auto request = _heldRequests[id];
+            _heldRequests[id] = {};
+            _inferRequests[id]._pool->Release(request);
+        }
+    }
+}
+
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (IsPipelined()) {
+        auto itBlob = _networkBlobs.find(name);
+        if (itBlob == _networkBlobs.end()) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        if (!blob) {
+            IE_THROW(NotAllocated) << "Failed to set empty blob with name: '" << name << "'";
+        }
+        itBlob->second = blob;
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +256,14 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (IsPipelined()) {
+        auto itSubgraph = _subgraphFromBlobName.find(name);
+        if (itSubgraph == _subgraphFromBlobName.end()) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        setPointerToSo(_inferRequests[itSubgraph->second]._network._so);
+        return _networkBlobs.at(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -103,6 +273,10 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (IsPipelined()) {
+        IE_THROW(NotImplemented) << "Pre-processing of blob with name: " << name
+                                 << " is not supported in the pipelined mode of HETERO";
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -111,6 +285,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (IsPipelined()) {
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -119,6 +296,21 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (IsPipelined()) {
+        try {
+            for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+                OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _inferRequests[id]._profilingTask);
+                auto request = _inferRequests[id]._pool->Acquire();
+                BindSubRequest(id, request);
+                request->Infer();
+                ReleaseSubRequests(id);
+            }
+        } catch (...) {
+            ReleaseAllSubRequests();
+            throw;
+        }
+        return;
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -129,6 +321,10 @@ void HeteroInferRequest::InferImpl() {
 
 std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInferRequest::QueryState() {
     memoryStates = {};
+    // the network is not pipelined if the subgraphs have states
+    if (IsPipelined()) {
+        return memoryStates;
+    }
     for (auto&& desc : _inferRequests) {
         auto& r = desc._request;
         assert(r);
@@ -142,7 +338,8 @@ std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInfe
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
+        auto perfMapRequest =
+            IsPipelined() ? _subgraphPerfCounts[i] : _inferRequests[i]._request->GetPerformanceCounts();
         for (auto&& r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
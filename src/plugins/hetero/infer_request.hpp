@@ -8,8 +8,11 @@
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
 #include <string>
 #include <unordered_map>
@@ -17,6 +20,48 @@
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Infer requests of one subgraph shared by all infer requests of the network in the pipelined mode.
+ * The number of requests bounds the number of inferences in flight for the subgraph, the rest wait for a free
+ * request in order of arrival.
+ */
+class SubRequestPool {
+public:
+    using Ptr = std::shared_ptr<SubRequestPool>;
+    using Callback = std::function<void(const InferenceEngine::SoIInferRequestInternal&)>;
+
+    SubRequestPool(const InferenceEngine::SoExecutableNetworkInternal& network,
+                   std::size_t depth,
+                   bool perfCount = false);
+
+    /**
+     * @brief Calls the callback with a free request, right away or from Release() of the request
+     */
+    void Acquire(Callback callback);
+
+    /**
+     * @brief Blocks the caller until there is a free request
+     */
+    InferenceEngine::SoIInferRequestInternal Acquire();
+
+    void Release(const InferenceEngine::SoIInferRequestInternal& request);
+
+    const std::vector<InferenceEngine::SoIInferRequestInternal>& GetRequests() const;
+
+    /**
+     * @brief Whether the performance counters are enabled for the pooled requests. A pooled request is reused by
+     * other infer requests once released, so its counters are read by the holder before the release
+     */
+    bool PerfCount() const;
+
+private:
+    std::vector<InferenceEngine::SoIInferRequestInternal> _requests;
+    std::vector<InferenceEngine::SoIInferRequestInternal> _freeRequests;
+    std::deque<Callback> _waiters;
+    std::mutex _mutex;
+    bool _perfCount = false;
+};
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -25,6 +70,8 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        // set in the pipelined mode, _request is not used then
+        SubRequestPool::Ptr _pool;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -54,12 +101,47 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    bool IsPipelined() const;
+
+    /**
+     * @brief Sets the network inputs and outputs and the outputs of the producer subgraphs to the subgraph request
+     * taken from the pool
+     */
+    void BindSubRequest(std::size_t id, const InferenceEngine::SoIInferRequestInternal& request);
+
+    /**
+     * @brief Returns the subgraph requests whose outputs are not needed anymore after the subgraph is inferred
+     */
+    void ReleaseSubRequests(std::size_t id);
+
+    /**
+     * @brief Returns all held subgraph requests to the pools if the inference fails
+     */
+    void ReleaseAllSubRequests();
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::SoIInferRequestInternal> _subRequestFromBlobName;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void CreatePipelinedInferRequest(
+        const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+
+    struct SubgraphInput {
+        std::string _name;
+        std::size_t _producer;
+        std::string _producerOutput;
+    };
+
+    // the pipelined mode: the network inputs and outputs are owned by the request and set to the subgraph requests
+    std::map<std::string, InferenceEngine::Blob::Ptr> _networkBlobs;
+    std::map<std::string, std::size_t> _subgraphFromBlobName;
+    std::vector<std::vector<SubgraphInput>> _subgraphInputs;
+    std::vector<std::vector<std::size_t>> _releasedAfter;
+    std::vector<InferenceEngine::SoIInferRequestInternal> _heldRequests;
+    // the performance counters of the subgraph requests read before they are returned to the pools
+    std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _subgraphPerfCounts;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
 };
 
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <utility>
 #include "lru_cache.h"
 
 namespace ov {
@@ -17,18 +20,38 @@ public:
         Hit,
         Miss
     };
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+
+    Statistics getStatistics() const {
+        Statistics stat;
+        stat.hits = _hits.load(std::memory_order_relaxed);
+        stat.misses = _misses.load(std::memory_order_relaxed);
+        stat.evictions = _evictions.load(std::memory_order_relaxed);
+        return stat;
+    }
+
+protected:
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _evictions{0};
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide bool put(KeyType, ValueType) (returns true if a record was evicted)
+ *         and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t, ...).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The entry is thread safe as long as ImplType is thread safe. The builder is called without any lock held,
+ *       so concurrent misses on the same key may build the value several times, the last built value is kept.
  */
 
 template<typename KeyType,
@@ -39,7 +62,8 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    template<typename... Args>
+    explicit CacheEntry(size_t capacity, Args&&... args) : _impl(capacity, std::forward<Args>(args)...) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -52,6 +76,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -59,9 +84,12 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            _misses.fetch_add(1, std::memory_order_relaxed);
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+            if (retVal != retEmpty && _impl.put(key, retVal))
+                _evictions.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
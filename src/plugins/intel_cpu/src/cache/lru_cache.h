@@ -30,12 +30,14 @@ public:
      * @brief Puts the value associated with the key into the cache.
      * @param key
      * @param value
+     * @return true if the least recently used record was evicted to free space for the new one
      */
 
-    void put(const Key &key, const Value &val) {
+    bool put(const Key &key, const Value &val) {
         if (0 == _capacity) {
-            return;
+            return false;
         }
+        bool evicted = false;
         auto mapItr = _cacheMapper.find(key);
         if (mapItr != _cacheMapper.end()) {
             touch(mapItr->second);
@@ -43,10 +45,12 @@ public:
         } else {
             if (_cacheMapper.size() == _capacity) {
                 evict(1);
+                evicted = true;
             }
             auto itr = _lruList.insert(_lruList.begin(), {key, val});
             _cacheMapper.insert({key, itr});
         }
+        return evicted;
     }
 
     /**
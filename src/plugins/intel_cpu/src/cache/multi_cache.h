@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,13 +17,14 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The cache is thread safe, so it may be shared between the graphs of all the streams of a compiled model.
+ * The records of each entry are split into shards protected by separate locks to reduce the contention.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -31,7 +34,15 @@ public:
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shardsNum = 1) : _capacity(capacity), _shardsNum(shardsNum) {}
+
+    /**
+    * @note The copy shares the entries with the original cache
+    */
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shardsNum(other._shardsNum) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -49,6 +60,21 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the lookup statistics accumulated over all the entries
+    */
+    CacheEntryBase::Statistics getStatistics() const {
+        CacheEntryBase::Statistics result;
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& entry : _storage) {
+            const auto stat = entry.second->getStatistics();
+            result.hits += stat.hits;
+            result.misses += stat.misses;
+            result.evictions += stat.evictions;
+        }
+        return result;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +84,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shardsNum;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,9 +99,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shardsNum)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "onednn/iml_type_mapper.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Results of the CPU graph compilation which are stored in the model cache together with the model.
+ * On import they are used to restore the graph without repeating the expensive compilation steps:
+ *  - implTypes: primitive implementation type selected for each node, so the import selects the same primitive
+ *    descriptors (and consequently the same memory layouts) as the original compilation.
+ *  - constants: data of the constant subgraph outputs consumed by the executable part of the graph (typically
+ *    weights reordered to the blocked layout required by the primitives), so the constant subgraph is not executed.
+ *  - elidedConstants: the constants which are only needed to compute the prepared constant data. Their data is not
+ *    stored in the model (it would be the second copy of the weights), so the imported network has zeros instead.
+ *    The constants are elided only for the model cache and only on request (CPU_CACHE_ELIDE_WEIGHTS), the model
+ *    exported otherwise keeps all its weights.
+ * The data is only a hint: a record which doesn't match the imported graph (e.g. the cache was created on a machine
+ * with another ISA) is ignored and the corresponding step is performed as usual. The only exception is an elided
+ * constant which turns out to be needed: the import fails, so the model is compiled from the original one.
+ */
+struct CompiledGraphData {
+    typedef std::shared_ptr<CompiledGraphData> Ptr;
+    typedef std::shared_ptr<const CompiledGraphData> CPtr;
+
+    struct ConstantData {
+        std::string descSignature;  // precision, shape and layout of the memory the data is valid for
+        std::vector<uint8_t> data;
+    };
+
+    std::unordered_map<std::string, impl_desc_type> implTypes;  // node name -> implementation type
+    std::unordered_map<std::string, ConstantData> constants;    // edge name -> constant data
+    std::unordered_set<std::string> elidedConstants;            // names of the elided constant nodes
+
+    bool empty() const {
+        return implTypes.empty() && constants.empty() && elidedConstants.empty();
+    }
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -178,6 +178,14 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_CACHE_ELIDE_WEIGHTS == key) {
+            if (val == PluginConfigParams::YES)
+                cacheElideWeights = true;
+            else if (val == PluginConfigParams::NO)
+                cacheElideWeights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CACHE_ELIDE_WEIGHTS
+                           << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -188,6 +196,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (CPUConfigParams::KEY_CPU_INTER_OP_PARALLEL == key) {
+            if (val == PluginConfigParams::YES)
+                interOpParallel = true;
+            else if (val == PluginConfigParams::NO)
+                interOpParallel = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_INTER_OP_PARALLEL
+                           << ". Expected only YES/NO";
+        } else if (CPUConfigParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::YES)
+                hugePages = true;
+            else if (val == PluginConfigParams::NO)
+                hugePages = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only YES/NO";
         } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
             if (val == PluginConfigInternalParams::ENABLE)
                 snippetsMode = SnippetsMode::Enable;
@@ -262,6 +286,14 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    if (interOpParallel)
+        _config.insert({ CPUConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES });
+    else
+        _config.insert({ CPUConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO });
+    if (hugePages)
+        _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES });
+    else
+        _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
 }
 
 }   // namespace intel_cpu
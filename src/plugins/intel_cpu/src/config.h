@@ -46,6 +46,8 @@ struct Config {
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    bool interOpParallel = false;
+    bool hugePages = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -60,6 +62,7 @@ struct Config {
 #endif
 
     std::string cache_dir{};
+    bool cacheElideWeights = false;
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
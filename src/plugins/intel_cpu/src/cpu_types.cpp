@@ -115,6 +115,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NV12toBGR", Type::ColorConvert },
         { "I420toRGB", Type::ColorConvert },
         { "I420toBGR", Type::ColorConvert },
+        { "FusedPreprocess", Type::FusedPreprocess },
         { "MVN", Type::MVN},
         { "NormalizeL2", Type::NormalizeL2},
         { "ScatterUpdate", Type::ScatterUpdate},
@@ -205,7 +206,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "PriorBoxClustered", Type::PriorBoxClustered},
         {"Interaction", Type::Interaction},
         { "MHA", Type::MHA},
-        { "Unique", Type::Unique}
+        { "Unique", Type::Unique},
+        { "RandomUniform", Type::RandomUniform}
 };
 
 Type TypeFromName(const std::string& type) {
@@ -301,6 +303,8 @@ std::string NameFromType(const Type type) {
             return "Convert";
         case Type::ColorConvert:
             return "ColorConvert";
+        case Type::FusedPreprocess:
+            return "FusedPreprocess";
         case Type::NormalizeL2:
             return "NormalizeL2";
         case Type::ScatterUpdate:
@@ -405,6 +409,8 @@ std::string NameFromType(const Type type) {
             return "MHA";
         case Type::Unique:
             return "Unique";
+        case Type::RandomUniform:
+            return "RandomUniform";
         default:
             return "Unknown";
     }
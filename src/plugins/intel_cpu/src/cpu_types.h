@@ -58,6 +58,7 @@ enum class Type {
     TensorIterator,
     Convert,
     ColorConvert,
+    FusedPreprocess,
     MVN,
     NormalizeL2,
     ScatterUpdate,
@@ -111,7 +112,8 @@ enum class Type {
     PriorBoxClustered,
     Interaction,
     MHA,
-    Unique
+    Unique,
+    RandomUniform
 };
 
 enum class Algorithm {
@@ -120,6 +120,8 @@ bool Edge::enforceReorder() {
     if (childCanChangeMem(*this) && portChildEdges.size() > 1) {
         if (childNode->getType() == Type::Convolution) {
             auto execIndex = childNode->getExecIndex();
+            // the peer consumers may be executed concurrently with the convolution in the inter-op parallel mode
+            const bool interOpParallel = childNode->context->getConfig().interOpParallel;
             for (auto pEdgePeer : portChildEdges) {
                 if (pEdgePeer.get() == this)
                     continue;
@@ -127,7 +129,7 @@ bool Edge::enforceReorder() {
                 pEdgePeer->collectConsumers(vecConsumers);
 
                 for (auto node : vecConsumers) {
-                    if (node->getExecIndex() >= execIndex) {
+                    if (interOpParallel || node->getExecIndex() >= execIndex) {
                         canBeInPlaceConflicts = true;
                         break;
                     }
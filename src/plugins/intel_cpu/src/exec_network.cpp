@@ -27,6 +27,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -65,12 +66,15 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const CompiledGraphData::CPtr &compiledGraphData) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _compiledGraphData(compiledGraphData),
+    _compilationProfile(ov::CompilationProfile::get_current()) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -120,6 +124,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    // the same primitives are requested by the graphs of all the streams, so they share the runtime cache,
+    // which is split into a shard per stream to reduce the lock contention
+    _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
@@ -139,6 +146,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    // all the graphs are ready, so the imported compilation results aren't needed anymore
+    _compiledGraphData.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -176,6 +185,8 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
+            // the graph may be created on a stream thread, so the profile is activated there
+            ov::CompilationProfile::Scope profileScope{_compilationProfile};
             try {
                 GraphContext::Ptr ctx;
                 {
@@ -188,7 +199,8 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag,
+                                                         _compiledGraphData, _rtParamsCache);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -309,6 +321,13 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::execution_devices.name()),
+            RO_property(ov::intel_cpu::inter_op_parallel.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::memory_plan_statistics.name()),
+            RO_property(ov::compilation_profile.name()),
+            RO_property(ov::intel_cpu::huge_pages.name()),
+            RO_property(ov::intel_cpu::dynamic_memory_statistics.name()),
+            RO_property(ov::intel_cpu::import_statistics.name()),
         };
     }
 
@@ -353,6 +372,51 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{_plugin->GetName()};
+    } else if (name == ov::intel_cpu::inter_op_parallel) {
+        return decltype(ov::intel_cpu::inter_op_parallel)::value_type(config.interOpParallel);
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        const auto stat = _rtParamsCache->getStatistics();
+        Graph::ShapeInferCacheStatistics shapeInferStat;
+        for (const auto& streamGraph : _graphs) {
+            const auto streamStat = streamGraph.GetShapeInferCacheStatistics();
+            shapeInferStat.hits += streamStat.hits;
+            shapeInferStat.misses += streamStat.misses;
+        }
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"HITS", stat.hits}, {"MISSES", stat.misses}, {"EVICTIONS", stat.evictions},
+            {"SHAPE_INFER_HITS", shapeInferStat.hits}, {"SHAPE_INFER_MISSES", shapeInferStat.misses}};
+    } else if (name == ov::intel_cpu::memory_plan_statistics) {
+        const auto& stat = graph.GetMemoryPlanStatistics();
+        return decltype(ov::intel_cpu::memory_plan_statistics)::value_type{
+            {"PLANNED_BYTES", stat.plannedSize}, {"LOWER_BOUND_BYTES", stat.lowerBound}};
+    } else if (name == ov::compilation_profile) {
+        return _compilationProfile ? *_compilationProfile : ov::CompilationProfile{};
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(config.hugePages);
+    } else if (name == ov::intel_cpu::dynamic_memory_statistics) {
+        MemoryArena::Statistics total;
+        for (const auto& streamGraph : _graphs) {
+            const auto stat = streamGraph.GetDynamicMemoryStatistics();
+            total.allocations += stat.allocations;
+            total.reuses += stat.reuses;
+            total.reallocations += stat.reallocations;
+            total.peakBytes += stat.peakBytes;
+            total.retainedBytes += stat.retainedBytes;
+        }
+        return decltype(ov::intel_cpu::dynamic_memory_statistics)::value_type{
+            {"ALLOCATIONS", total.allocations}, {"REUSES", total.reuses}, {"REALLOCATIONS", total.reallocations},
+            {"PEAK_BYTES", total.peakBytes}, {"RETAINED_BYTES", total.retainedBytes}};
+    } else if (name == ov::intel_cpu::import_statistics) {
+        Graph::ImportStatistics total;
+        for (const auto& streamGraph : _graphs) {
+            const auto& stat = streamGraph.GetImportStatistics();
+            total.restoredImplTypes += stat.restoredImplTypes;
+            total.restoredConstants += stat.restoredConstants;
+            total.skippedConstantNodes += stat.skippedConstantNodes;
+        }
+        return decltype(ov::intel_cpu::import_statistics)::value_type{
+            {"RESTORED_IMPL_TYPES", total.restoredImplTypes}, {"RESTORED_CONSTANTS", total.restoredConstants},
+            {"SKIPPED_CONSTANT_NODES", total.skippedConstantNodes}};
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -542,7 +606,9 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
+    const auto compiledGraphData = GetGraph()._graph.GetCompiledGraphData();
     CNNNetworkSerializer serializer(modelStream, extensionManager);
+    serializer << *compiledGraphData;
     serializer <<_network;
 }
 
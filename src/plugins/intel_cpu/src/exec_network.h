@@ -11,6 +11,7 @@
 #include "extension_mngr.h"
 #include "graph_context.h"
 #include <threading/ie_thread_local.hpp>
+#include <openvino/core/compilation_profile.hpp>
 
 #include <vector>
 #include <memory>
@@ -37,7 +38,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const CompiledGraphData::CPtr &compiledGraphData = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -69,6 +71,11 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    MultiCachePtr                               _rtParamsCache;  // runtime cache shared by the graphs of all the streams
+    // compilation results imported from the model cache, used to speed up the graphs creation and released after it
+    CompiledGraphData::CPtr                     _compiledGraphData;
+    // the profile of the compile_model call, the graphs created later for the streams are added to it
+    std::shared_ptr<ov::CompilationProfile>     _compilationProfile;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -48,11 +48,13 @@
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/ops.hpp>
+#include <openvino/core/compilation_profile.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #   include <tbb/task_group.h>
 #endif
@@ -74,6 +76,7 @@ Graph::~Graph() {
 template<typename NET>
 void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
+    ov::CompilationProfile::Stage profileStage("graph_init");
 
     if (IsReady())
         ForgetGraphData();
@@ -81,6 +84,7 @@ void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
     context = ctx;
 
     Replicate(net);
+    profileStage.set_name(_name);
 
     InitGraph();
 
@@ -404,10 +408,14 @@ void Graph::InitGraph() {
     // we disalbe io mem reuse for the case of dynamic shapes.
     if (haveDynNodes) {
         this->reuse_io_tensors = false;
+    } else {
+        InitInterOpLevels();
     }
 
     Allocate();
 
+    InitInterOpStages();
+
     CreatePrimitives();
 
 #ifndef CPU_DEBUG_CAPS
@@ -418,6 +426,9 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+    if (haveDynNodes) {
+        InitShapeInferCache();
+    }
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -431,6 +442,8 @@ void Graph::InitNodes() {
 void Graph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
 
+    const auto compiledData = context->getCompiledGraphData();
+
     for (auto &node : graphNodes) {
         if (node->getType() == Type::Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<node::Input *>(node.get());
@@ -447,6 +460,23 @@ void Graph::InitDescriptors() {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
         node->filterSupportedPrimitiveDescriptors();
 
+        if (compiledData) {
+            // select the same implementation as the original compilation did (if it is still available)
+            auto implType = compiledData->implTypes.find(node->getName());
+            if (implType != compiledData->implTypes.end()) {
+                auto& supportedPDs = node->supportedPrimitiveDescriptors;
+                const auto hasImplType = [&](const NodeDesc& pd) {
+                    return pd.getImplementationType() == implType->second;
+                };
+                if (std::any_of(supportedPDs.begin(), supportedPDs.end(), hasImplType)) {
+                    supportedPDs.erase(std::remove_if(supportedPDs.begin(), supportedPDs.end(),
+                                                      [&](const NodeDesc& pd) { return !hasImplType(pd); }),
+                                       supportedPDs.end());
+                    importStatistics.restoredImplTypes++;
+                }
+            }
+        }
+
 #ifdef CPU_DEBUG_CAPS
         DEBUG_LOG("==================");
         for (auto & pd : node->getSupportedPrimitiveDescriptors())
@@ -491,6 +521,78 @@ void Graph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+void Graph::InitInterOpLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitInterOpLevels");
+    interOpLevels.clear();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!getConfig().interOpParallel || context->getScratchPadsNum() < 2)
+        return;
+
+    // The nodes below have dependencies which are not expressed by the graph edges (states)
+    // or execute inner graphs sharing the same context, so such graphs are executed sequentially.
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput, Type::TensorIterator, Type::If))
+            return;
+    }
+
+    std::unordered_map<int, size_t> levelsWidth;
+    size_t maxWidth = 0;
+    // graphNodes are sorted topologically, so the parents levels are already known
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, interOpLevels[parent.get()] + 1);
+        }
+        interOpLevels[node.get()] = level;
+
+        if (!node->isConstant() && !one_of(node->getType(), Type::Input, Type::Output)) {
+            maxWidth = std::max(maxWidth, ++levelsWidth[level]);
+        }
+    }
+
+    // there are no independent branches, so the regular sequential execution is used
+    if (maxWidth < 2)
+        interOpLevels.clear();
+#endif
+}
+
+void Graph::InitInterOpStages() {
+    interOpStages.clear();
+    if (interOpLevels.empty())
+        return;
+
+    std::map<int, std::vector<NodePtr>> levels;
+    for (const auto& node : graphNodes) {
+        if (node->isConstant() || !CPU_DEBUG_CAPS_ALWAYS_TRUE(node->isExecutable()))
+            continue;
+        levels[interOpLevels.at(node.get())].push_back(node);
+    }
+
+    // The branch index defines the scratch pad used by the node, so it must be set before the primitives creation
+    const size_t maxBranches = static_cast<size_t>(context->getScratchPadsNum());
+    for (auto& level : levels) {
+        const auto& nodes = level.second;
+        InterOpStage stage;
+        stage.branches.resize(std::min(nodes.size(), maxBranches));
+        stage.branchesPerf.resize(stage.branches.size());
+        for (size_t i = 0; i < nodes.size(); i++) {
+            const auto branchId = i % stage.branches.size();
+            nodes[i]->interOpBranch = static_cast<int>(branchId);
+            stage.branches[branchId].push_back(nodes[i]);
+        }
+        interOpStages.push_back(std::move(stage));
+    }
+}
+
+// The constants which are smaller are stored in the model even if they are consumed only through the prepared data
+static constexpr size_t minElidedConstantSize = 4096;
+
+// Describes the memory the prepared constant data stored in the model cache is valid for
+static std::string constantDescSignature(const MemoryDesc& desc) {
+    return std::string(desc.getPrecision().name()) + " " + desc.getShape().toString() + " " + desc.serializeFormat();
+}
+
 void Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(getEngine());
@@ -519,22 +621,178 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // The constant data prepared by the original compilation (restored from the model cache) is copied to the
+    // corresponding edges, and the constant nodes whose outputs are not needed anymore are not executed at all
+    std::unordered_map<const Edge*, const CompiledGraphData::ConstantData*> restoredEdges;
+    std::unordered_set<Node*> neededNodes;
+    if (const auto compiledData = context->getCompiledGraphData()) {
+        for (const auto& edge : GetPreparedConstantEdges()) {
+            auto constant = compiledData->constants.find(edge->name());
+            if (constant != compiledData->constants.end() &&
+                constant->second.descSignature == constantDescSignature(edge->getMemory().getDesc()) &&
+                constant->second.data.size() == edge->getMemory().GetSize()) {
+                restoredEdges[edge.get()] = &constant->second;
+            }
+        }
+        neededNodes = GetNeededConstantNodes([&](const Edge* edge) { return restoredEdges.count(edge) != 0; });
+
+        // the data of the elided constants is not in the model, it can't be recomputed
+        for (const auto& node : neededNodes) {
+            if (compiledData->elidedConstants.count(node->getName())) {
+                IE_THROW(NetworkNotRead) << "The constant " << node->getName()
+                                         << " is not stored in the model and the prepared data doesn't match the graph.";
+            }
+        }
+        importStatistics.restoredConstants = restoredEdges.size();
+        importStatistics.skippedConstantNodes = constantGraphNodes.size() - neededNodes.size();
+    } else {
+        for (const auto &node : constantGraphNodes)
+            neededNodes.insert(node.get());
+    }
+
+    auto restoreOutputs = [&](const NodePtr & node) {
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            auto restored = restoredEdges.find(edgePtr.get());
+            if (restored == restoredEdges.end())
+                continue;
+
+            const auto& data = restored->second->data;
+            if (edgePtr->isUseExternalMemory()) {
+                auto ptr = context->getWeightsCache()->get(edgePtr->name());
+                if (!ptr->isValid()) {
+                    cpu_memcpy(edgePtr->getMemory().GetData(), data.data(), data.size());
+                    ptr->valid(true);
+                }
+            } else {
+                cpu_memcpy(edgePtr->getMemory().GetData(), data.data(), data.size());
+            }
+        }
+    };
+
+    auto executeConstantNode = [&](const NodePtr& node) {
+        // the reorders on the constant path prepare the weights layout for the executable nodes
+        ov::CompilationProfile::Stage profileStage(node->getType() == Type::Reorder ? "weights_reorder" : "constant_node",
+                                                   node->getName());
+        ExecuteNode(node, stream);
+    };
+
     for (const auto &node : constantGraphNodes) {
+        if (!neededNodes.count(node.get())) {
+            restoreOutputs(node);
+            continue;
+        }
+
         if (context->getWeightsCache()) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                executeConstantNode(node);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            executeConstantNode(node);
         }
     }
 }
 
+std::unordered_set<Node*> Graph::GetNeededConstantNodes(const std::function<bool(const Edge*)>& isRestored) const {
+    // A constant node has to be executed if any of its outputs is neither restored nor consumed only by the constant
+    // nodes which are not executed, so the nodes are visited from the consumers to the producers
+    std::unordered_set<Node*> neededNodes;
+    for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+        const auto& node = *it;
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            auto baseEdge = edgePtr->getSharedEdge(std::nothrow);
+            if (isRestored(baseEdge ? baseEdge.get() : edgePtr.get()))
+                continue;
+            const auto child = edgePtr->getChild();
+            if (!child->isConstant() || neededNodes.count(child.get())) {
+                neededNodes.insert(node.get());
+                break;
+            }
+        }
+    }
+    return neededNodes;
+}
+
+std::vector<EdgePtr> Graph::GetPreparedConstantEdges() const {
+    // The outputs of the constant subgraph consumed by the executable nodes (e.g. the reordered weights).
+    // Only the edges which own the memory are taken, the rest of the edges of the port share it.
+    std::vector<EdgePtr> result;
+    for (const auto& node : constantGraphNodes) {
+        if (node->getType() == Type::Input)
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            if (edgePtr->getChild()->isConstant())
+                continue;
+            auto baseEdge = edgePtr->getSharedEdge(std::nothrow);
+            if (!baseEdge)
+                baseEdge = edgePtr;
+            if (baseEdge->getParent() == node && baseEdge->getMemory().getDesc().isDefined() &&
+                std::find(result.begin(), result.end(), baseEdge) == result.end()) {
+                result.push_back(baseEdge);
+            }
+        }
+    }
+    return result;
+}
+
+CompiledGraphData::Ptr Graph::GetCompiledGraphData() const {
+    auto compiledData = std::make_shared<CompiledGraphData>();
+
+    for (const auto& node : graphNodes) {
+        const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (selectedPD && selectedPD->getImplementationType() != impl_desc_type::unknown)
+            compiledData->implTypes[node->getName()] = selectedPD->getImplementationType();
+    }
+
+    std::unordered_set<const Edge*> preparedEdges;
+    for (const auto& edge : GetPreparedConstantEdges()) {
+        const auto& memory = edge->getMemory();
+        auto& constant = compiledData->constants[edge->name()];
+        constant.descSignature = constantDescSignature(memory.getDesc());
+        const auto data = static_cast<const uint8_t*>(memory.GetData());
+        constant.data.assign(data, data + memory.GetSize());
+        preparedEdges.insert(edge.get());
+    }
+
+    // The weights elided from the model the graph is imported from hold zeros, they stay elided on the export
+    if (const auto importedData = context->getCompiledGraphData())
+        compiledData->elidedConstants = importedData->elidedConstants;
+
+    // The exported model keeps all the original weights unless the elision is requested for the model cache, where
+    // the original model is available to compile it again if the prepared data can't be used.
+    if (!getConfig().cacheElideWeights || getConfig().cache_dir.empty())
+        return compiledData;
+
+    // The weights which are consumed only through the prepared data are not stored in the model once again.
+    // The small constants and the integer ones are kept: they may define the shapes (e.g. the axes or the scales of
+    // Interpolate), which are needed to validate the network on import.
+    const auto neededNodes = GetNeededConstantNodes([&](const Edge* edge) { return preparedEdges.count(edge) != 0; });
+    std::unordered_set<std::string> neededNames;
+    for (const auto& node : constantGraphNodes) {
+        if (node->getType() != Type::Input || node->getChildEdges().empty())
+            continue;
+        const auto& memory = node->getChildEdgeAt(0)->getMemory();
+        if (neededNodes.count(node.get()) || !memory.getDesc().getPrecision().is_float() ||
+            memory.GetSize() < minElidedConstantSize) {
+            neededNames.insert(node->getName());
+        } else {
+            compiledData->elidedConstants.insert(node->getName());
+        }
+    }
+    // the constants are matched by name in the serialized network
+    for (const auto& name : neededNames)
+        compiledData->elidedConstants.erase(name);
+
+    return compiledData;
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -707,14 +965,20 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In the inter-op parallel mode the nodes of the same level are executed concurrently,
+    // so the lifetime of the memory is measured in the levels instead of the execution indices
+    auto execTimestamp = [this](const NodePtr& node) {
+        return interOpLevels.empty() ? node->execIndex : interOpLevels.at(node.get());
+    };
+
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execTimestamp(edge->getParent());
+            int e_finish = execTimestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -757,7 +1021,9 @@ void Graph::AllocateWithReuse() {
     }
 
     MemorySolver staticMemSolver(definedBoxes);
-    size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+    size_t total_size = static_cast<size_t>(staticMemSolver.solve(MemorySolver::Strategy::BEST_OF_HEURISTICS)) * alignment;
+    memPlanStatistics.plannedSize = total_size;
+    memPlanStatistics.lowerBound = static_cast<size_t>(staticMemSolver.maxDepth()) * alignment;
 
     memWorkspace = std::make_shared<Memory>(getEngine());
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
@@ -840,9 +1106,12 @@ void Graph::AllocateWithReuse() {
                 groups.push_back({box});
             }
         }
+        // the memory of all the groups is taken from the same pool, so the blocks released by a group
+        // on the shape growth are reused by the other ones
+        dynamicMemArena = std::make_shared<MemoryArena>(getConfig().hugePages);
         for (auto& group : groups) {
-            auto grpMemMngr =
-                std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+            auto grpMemMngr = std::make_shared<DnnlMemoryMngr>(
+                std::unique_ptr<MemoryMngrWithArena>(new MemoryMngrWithArena(dynamicMemArena)));
             for (auto& box : group) {
                 for (auto& edge : edge_clusters[box.id]) {
                     if (edge->getStatus() == Edge::Status::NeedAllocation) {
@@ -876,6 +1145,7 @@ void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+        ov::CompilationProfile::Stage profileStage("primitive_creation", node->getName());
         DEBUG_LOG(*node);
         node->createPrimitive();
 #ifdef CPU_DEBUG_CAPS
@@ -1039,6 +1309,11 @@ void Graph::PullOutputData(BlobMap &out) {
 }
 
 void Graph::InferStatic(InferRequestBase* request) {
+    if (!interOpStages.empty()) {
+        InferInterOpParallel(request);
+        return;
+    }
+
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
@@ -1051,9 +1326,141 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferInterOpParallel(InferRequestBase* request) {
+    size_t branchesNum = 0;
+    for (const auto& stage : interOpStages) {
+        branchesNum = std::max(branchesNum, stage.branches.size());
+    }
+    // each branch is executed on its own oneDNN stream
+    std::vector<dnnl::stream> streams;
+    streams.reserve(branchesNum);
+    for (size_t i = 0; i < branchesNum; i++) {
+        streams.emplace_back(getEngine());
+    }
+
+    const bool collectPerfCounters = getConfig().collectPerfCounters;
+
+    auto executeBranch = [&](InterOpStage& stage, size_t branchId) {
+        auto branchPerf = collectPerfCounters ? std::unique_ptr<PerfHelper>(new PerfHelper(stage.branchesPerf[branchId])) : nullptr;
+        for (const auto& node : stage.branches[branchId]) {
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, streams[branchId]);
+        }
+    };
+
+    for (auto& stage : interOpStages) {
+        if (stage.branches.size() == 1) {
+            executeBranch(stage, 0);
+        } else {
+            parallel_for(stage.branches.size(), [&](size_t branchId) {
+                executeBranch(stage, branchId);
+            });
+        }
+    }
+}
+
+namespace {
+// the dynamic models usually get a few distinct sets of the input shapes, so a small cache is enough
+constexpr size_t maxShapeInferCacheCapacity = 64;
+} // namespace
+
+size_t Graph::ShapeInferCacheKey::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
+bool Graph::ShapeInferCacheKey::operator==(const ShapeInferCacheKey& rhs) const {
+    return inputDims == rhs.inputDims;
+}
+
+void Graph::InitShapeInferCache() {
+    shapeInferCache.reset();
+    const auto capacity = std::min(getConfig().rtCacheCapacity, maxShapeInferCacheCapacity);
+    if (capacity == 0) {
+        return;
+    }
+    shapeInferCache.reset(new ShapeInferCache(capacity));
+}
+
+Graph::ShapeInferCacheKey Graph::GetShapeInferCacheKey() const {
+    ShapeInferCacheKey key;
+    key.inputDims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto childEdges = input.second->getChildEdgesAtPort(0);
+        key.inputDims.push_back(childEdges.empty() ? VectorDims{} : childEdges[0]->getMemory().getStaticDims());
+    }
+    return key;
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
+    // the output shapes inferred for the same input shapes before are taken from the cache, the rest of the nodes
+    // record their shapes into the entry
+    std::shared_ptr<ShapeInferCacheEntry> cachedShapes;
+    if (shapeInferCache) {
+        const auto key = GetShapeInferCacheKey();
+        cachedShapes = shapeInferCache->get(key);
+        if (cachedShapes) {
+            shapeInferCacheHits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            shapeInferCacheMisses.fetch_add(1, std::memory_order_relaxed);
+            cachedShapes = std::make_shared<ShapeInferCacheEntry>(executableGraphNodes.size());
+            shapeInferCache->put(key, cachedShapes);
+        }
+    }
+
+    // The nodes which are not replayable (e.g. Reshape fed by ShapeOf of another branch) are not taken from the cache.
+    // Their output shapes are defined either by the shape inference or on execution (internal dynamism), so they are
+    // compared with the recorded ones right before the next node is updated: the nodes are updated in the execution
+    // order and a sync point node is executed before the following nodes are updated. Once the shapes differ, the cached
+    // shapes of the following nodes may be stale as well, so they are inferred and recorded anew.
+    bool diverged = false;
+    std::vector<size_t> uncheckedNodes;
+    auto checkOutputShapes = [&]() {
+        for (const auto nodeIndx : uncheckedNodes) {
+            const auto& node = executableGraphNodes[nodeIndx];
+            std::vector<VectorDims> shapes;
+            for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
+                shapes.push_back(node->getChildEdgesAtPort(i)[0]->getMemory().getStaticDims());
+            }
+            auto& outputShapes = (*cachedShapes)[nodeIndx];
+            diverged = diverged || (outputShapes.inferred && outputShapes.shapes != shapes);
+            outputShapes.shapes = std::move(shapes);
+            outputShapes.inferred = true;
+        }
+        uncheckedNodes.clear();
+    };
+    auto updateNodeShapes = [&](size_t nodeIndx) {
+        const auto& node = executableGraphNodes[nodeIndx];
+        if (!cachedShapes) {
+            node->updateShapes();
+            return;
+        }
+        checkOutputShapes();
+        if (!node->isShapeInferReplayable()) {
+            node->updateShapes();
+            uncheckedNodes.push_back(nodeIndx);
+            return;
+        }
+        if (node->needShapeInfer()) {
+            auto& outputShapes = (*cachedShapes)[nodeIndx];
+            if (!outputShapes.inferred || diverged) {
+                outputShapes.shapes = node->shapeInfer();
+                outputShapes.inferred = true;
+            }
+            node->redefineOutputMemory(outputShapes.shapes);
+        }
+    };
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1084,7 +1491,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
             return;
         }
         if (node->isDynamicNode()) {
-            node->updateShapes();
+            updateNodeShapes(node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1117,7 +1524,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1284,6 +1691,25 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
             continue;
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    // per branch timings of the inter-op parallel stages
+    for (size_t stageId = 0; stageId < interOpStages.size(); stageId++) {
+        const auto& stage = interOpStages[stageId];
+        if (stage.branches.size() < 2)
+            continue;
+        for (size_t branchId = 0; branchId < stage.branches.size(); branchId++) {
+            const auto name = "InterOpStage_" + std::to_string(stageId) + "_Branch_" + std::to_string(branchId);
+            InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[name];
+            pc.execution_index = i++;
+            pc.cpu_uSec = pc.realTime_uSec = (long long) stage.branchesPerf[branchId].avg();
+            pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                        : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+            const std::string execType = "inter_op_branch";
+            execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+            const std::string layerType = "InterOpBranch";
+            layerType.copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+        }
+    }
 }
 
 void Graph::RemoveEdge(EdgePtr& edge) {
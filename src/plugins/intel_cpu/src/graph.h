@@ -7,17 +7,23 @@
 #include "cpp/ie_cnn_network.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "memory_arena.h"
+#include "perf_count.h"
 #include "normalize_preprocess.h"
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "compiled_graph_data.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <unordered_set>
 
 namespace ov {
 namespace intel_cpu {
@@ -115,6 +121,60 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Collects the compilation results which allow to restore the graph faster on the model import
+     * (the selected implementation types, the prepared constant data and the constants which are not needed with it).
+     */
+    CompiledGraphData::Ptr GetCompiledGraphData() const;
+
+    /**
+     * @brief Sizes of the memory workspace shared by the static shape edges (in bytes): the size allocated by
+     * the memory planner and the lower bound of it (the maximal total size of the simultaneously alive edges).
+     */
+    struct MemoryPlanStatistics {
+        size_t plannedSize = 0;
+        size_t lowerBound = 0;
+    };
+
+    const MemoryPlanStatistics& GetMemoryPlanStatistics() const {
+        return memPlanStatistics;
+    }
+
+    /**
+     * @brief Statistics of the memory pool of the dynamic shape edges
+     */
+    MemoryArena::Statistics GetDynamicMemoryStatistics() const {
+        return dynamicMemArena ? dynamicMemArena->getStatistics() : MemoryArena::Statistics{};
+    }
+
+    /**
+     * @brief Lookup statistics of the cache of the dynamic nodes output shapes
+     */
+    struct ShapeInferCacheStatistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    /**
+     * @brief How much of the graph was restored from the compilation results stored in the imported model
+     */
+    struct ImportStatistics {
+        uint64_t restoredImplTypes = 0;     // nodes with the primitive descriptors selected by the cached types
+        uint64_t restoredConstants = 0;     // edges filled with the prepared constant data
+        uint64_t skippedConstantNodes = 0;  // constant nodes which were not executed
+    };
+
+    const ImportStatistics& GetImportStatistics() const {
+        return importStatistics;
+    }
+
+    ShapeInferCacheStatistics GetShapeInferCacheStatistics() const {
+        ShapeInferCacheStatistics stat;
+        stat.hits = shapeInferCacheHits.load(std::memory_order_relaxed);
+        stat.misses = shapeInferCacheMisses.load(std::memory_order_relaxed);
+        return stat;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -202,6 +262,9 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        shapeInferCache.reset();
+        interOpLevels.clear();
+        interOpStages.clear();
     }
     Status status { Status::NotReady };
 
@@ -212,6 +275,9 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    MemoryPlanStatistics memPlanStatistics;
+    mutable ImportStatistics importStatistics;
+    MemoryArena::Ptr dynamicMemArena;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -234,7 +300,12 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    std::vector<EdgePtr> GetPreparedConstantEdges() const;
+    std::unordered_set<Node*> GetNeededConstantNodes(const std::function<bool(const Edge*)>& isRestored) const;
+    void InitInterOpLevels();
+    void InitInterOpStages();
     void InferStatic(InferRequestBase* request);
+    void InferInterOpParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -255,6 +326,42 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // The output shapes of the dynamic nodes memoized by the graph input shapes, so the shape inference is not repeated
+    // for the recurring sets of the input shapes. The nodes whose output shapes depend on the input data
+    // (see Node::isShapeInferReplayable) are not taken from the cache and invalidate the shapes of the following nodes
+    // once their output shapes differ from the recorded ones.
+    struct ShapeInferCacheKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferCacheKey& rhs) const;
+    };
+    // the output shapes of each executable node, recorded when the shape inference is actually called for the node
+    struct NodeOutputShapes {
+        bool inferred = false;
+        std::vector<VectorDims> shapes;
+    };
+    using ShapeInferCacheEntry = std::vector<NodeOutputShapes>;
+    using ShapeInferCache = LruCache<ShapeInferCacheKey, std::shared_ptr<ShapeInferCacheEntry>>;
+
+    std::unique_ptr<ShapeInferCache> shapeInferCache;
+    std::atomic<uint64_t> shapeInferCacheHits{0};
+    std::atomic<uint64_t> shapeInferCacheMisses{0};
+
+    void InitShapeInferCache();
+    ShapeInferCacheKey GetShapeInferCacheKey() const;
+
+    // Inter-op parallel mode: each node is assigned a level in the dependency DAG (the length of the longest path
+    // from the graph inputs), so the nodes of the same level are independent. The executable nodes of a level form
+    // a stage, whose branches are executed concurrently. The levels are also used as the execution timestamps
+    // for the memory reuse, so the stages must be executed strictly one after another.
+    struct InterOpStage {
+        std::vector<std::vector<NodePtr>> branches;
+        std::vector<PerfCount> branchesPerf;
+    };
+    std::unordered_map<const Node*, int> interOpLevels;
+    std::vector<InterOpStage> interOpStages;
+
     GraphContext::CPtr context;
 
     void EnforceBF16();
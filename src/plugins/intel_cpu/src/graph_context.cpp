@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include <dnnl_types.h>
+#include <ie_parallel.hpp>
 #include "graph_context.h"
 
 namespace ov {
@@ -9,5 +10,29 @@ namespace intel_cpu {
 
 dnnl::engine GraphContext::eng(dnnl::engine::kind::cpu, 0);
 
+GraphContext::GraphContext(const Config& config,
+                           ExtensionManager::Ptr extensionManager,
+                           WeightsSharing::Ptr w_cache,
+                           std::shared_ptr<std::mutex> sharedMutex,
+                           bool isGraphQuantized,
+                           CompiledGraphData::CPtr compiledGraphData,
+                           MultiCachePtr paramsCache)
+    : config(config),
+      extensionManager(extensionManager),
+      weightsCache(w_cache),
+      sharedMutex(sharedMutex),
+      rtParamsCache(paramsCache),
+      isGraphQuantizedFlag(isGraphQuantized),
+      compiledGraphData(compiledGraphData) {
+    if (!rtParamsCache)
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    // Concurrently executed nodes must not share the scratch memory, so in the inter-op parallel mode
+    // the context provides a separate scratch pad for each branch. The memory is allocated on demand.
+    const int numScratchPads = config.interOpParallel ? std::max(1, parallel_get_max_threads()) : 1;
+    for (int i = 0; i < numScratchPads; i++) {
+        rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(eng));
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
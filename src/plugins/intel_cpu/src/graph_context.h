@@ -5,11 +5,14 @@
 #pragma once
 
 #include "cache/multi_cache.h"
+#include "compiled_graph_data.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
 
+#include <vector>
+
 namespace ov {
 namespace intel_cpu {
 
@@ -22,15 +25,9 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
-        : config(config),
-          extensionManager(extensionManager),
-          weightsCache(w_cache),
-          sharedMutex(sharedMutex),
-          isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
-    }
+                 bool isGraphQuantized,
+                 CompiledGraphData::CPtr compiledGraphData = nullptr,
+                 MultiCachePtr paramsCache = nullptr);
 
     const Config& getConfig() const {
         return config;
@@ -52,8 +49,13 @@ public:
         return rtParamsCache;
     }
 
-    DnnlScratchPadPtr getScratchPad() const {
-        return rtScratchPad;
+    DnnlScratchPadPtr getScratchPad(int branchId = 0) const {
+        return rtScratchPads[branchId];
+    }
+
+    // number of the graph branches which may be executed concurrently (each of them owns a scratch pad)
+    int getScratchPadsNum() const {
+        return static_cast<int>(rtScratchPads.size());
     }
 
     dnnl::engine getEngine() const {
@@ -64,6 +66,11 @@ public:
         return isGraphQuantizedFlag;
     }
 
+    // available only while the graphs of the imported model are being created
+    CompiledGraphData::CPtr getCompiledGraphData() const {
+        return compiledGraphData.lock();
+    }
+
 private:
     Config config;  // network-level config
 
@@ -71,10 +78,11 @@ private:
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
     std::shared_ptr<std::mutex> sharedMutex;  // mutex for protection of type-relaxed Op in clone_model()
 
-    MultiCachePtr rtParamsCache;     // primitive cache
-    DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    MultiCachePtr rtParamsCache;     // primitive cache (may be shared between the graphs of a compiled model)
+    std::vector<DnnlScratchPadPtr> rtScratchPads;  // scratch pads (one per inter-op branch)
 
     bool isGraphQuantizedFlag = false;
+    std::weak_ptr<const CompiledGraphData> compiledGraphData;  // compilation results restored from the model cache
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
@@ -102,12 +102,12 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Unexpected type of the variable state " << cur_id;
+                    }
+                    // the graph reads and writes the state buffers of this request
+                    cur_node->setStateBuffers(cur_state->getCurrentData(), cur_state->getNextData());
                 }
             }
         }
@@ -123,13 +123,8 @@ void InferRequestBase::PullStates() {
             }
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                if (state->GetName() == cur_id && cur_node->isNextStateWritten()) {
+                    std::static_pointer_cast<VariableState>(state)->swapBuffers();
                 }
             }
         }
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_arena.h"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include <ie_common.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+constexpr size_t MemoryArena::hugePageSize;
+
+MemoryArena::~MemoryArena() {
+    for (const auto& block : _retained) {
+        deallocate(block.second);
+    }
+}
+
+size_t MemoryArena::sizeClass(size_t size) {
+    constexpr size_t cacheLineSize = 64;
+    constexpr size_t smallSize = 1024;
+    if (size <= smallSize) {
+        return (size + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+    }
+    size_t powerOfTwo = smallSize;
+    while (powerOfTwo <= size / 2) {
+        powerOfTwo *= 2;
+    }
+    const size_t step = powerOfTwo / 4;
+    return (size + step - 1) / step * step;
+}
+
+void* MemoryArena::acquire(size_t size, size_t& capacity) {
+    size_t requested = sizeClass(size);
+    if (_useHugePages && requested >= hugePageSize) {
+        requested = (requested + hugePageSize - 1) / hugePageSize * hugePageSize;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    void* ptr = nullptr;
+    // the best fitting retained block, but not the one much bigger than requested
+    auto found = _retained.lower_bound(requested);
+    if (found != _retained.end() && found->first <= 2 * requested) {
+        ptr = found->second;
+        capacity = found->first;
+        _retained.erase(found);
+        _stat.retainedBytes -= capacity;
+        _stat.reuses++;
+    } else {
+        // the retained blocks which don't fit are returned to the system to stay within the high watermark
+        trim(std::max<size_t>(_stat.peakBytes, _inUseBytes + requested) - _inUseBytes - requested);
+        ptr = allocate(requested);
+        capacity = requested;
+        _stat.allocations++;
+    }
+    _inUseBytes += capacity;
+    _stat.peakBytes = std::max<uint64_t>(_stat.peakBytes, _inUseBytes);
+    return ptr;
+}
+
+void MemoryArena::release(void* ptr, size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _inUseBytes -= capacity;
+    if (_inUseBytes + _stat.retainedBytes + capacity <= _stat.peakBytes) {
+        _retained.emplace(capacity, ptr);
+        _stat.retainedBytes += capacity;
+    } else {
+        deallocate(ptr);
+    }
+}
+
+void MemoryArena::countReallocation() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stat.reallocations++;
+}
+
+MemoryArena::Statistics MemoryArena::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stat;
+}
+
+void* MemoryArena::allocate(size_t capacity) {
+    constexpr int cacheLineSize = 64;
+    const bool hugePages = _useHugePages && capacity >= hugePageSize;
+    void* ptr = dnnl::impl::malloc(capacity, hugePages ? static_cast<int>(hugePageSize) : cacheLineSize);
+    if (!ptr) {
+        IE_THROW() << "Failed to allocate " << capacity << " bytes of memory";
+    }
+#ifdef __linux__
+    if (hugePages) {
+        // only a hint, the regular pages are used if the transparent huge pages are not available
+        madvise(ptr, capacity, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+void MemoryArena::deallocate(void* ptr) {
+    dnnl::impl::free(ptr);
+}
+
+void MemoryArena::trim(size_t limit) {
+    // the smallest blocks are released first as they are the least likely to fit the growing shapes
+    while (_stat.retainedBytes > limit && !_retained.empty()) {
+        auto block = _retained.begin();
+        deallocate(block->second);
+        _stat.retainedBytes -= block->first;
+        _retained.erase(block);
+    }
+}
+
+MemoryMngrWithArena::~MemoryMngrWithArena() {
+    releaseBlock();
+}
+
+void* MemoryMngrWithArena::getRawPtr() const noexcept {
+    return _data;
+}
+
+void MemoryMngrWithArena::setExtBuff(void* ptr, size_t size) {
+    releaseBlock();
+    _useExternalStorage = true;
+    _memUpperBound = size;
+    _data = ptr;
+}
+
+bool MemoryMngrWithArena::resize(size_t size) {
+    if (size <= _memUpperBound) {
+        return false;
+    }
+    const bool grown = _block != nullptr;
+    releaseBlock();
+    _memUpperBound = 0;
+    _data = nullptr;
+    _block = _arena->acquire(size, _blockCapacity);
+    _memUpperBound = _blockCapacity;
+    _useExternalStorage = false;
+    _data = _block;
+    if (grown) {
+        _arena->countReallocation();
+    }
+    return true;
+}
+
+bool MemoryMngrWithArena::hasExtBuffer() const noexcept {
+    return _useExternalStorage;
+}
+
+void MemoryMngrWithArena::releaseBlock() {
+    if (_block) {
+        _arena->release(_block, _blockCapacity);
+        if (_data == _block) {
+            _data = nullptr;
+        }
+        _block = nullptr;
+        _blockCapacity = 0;
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
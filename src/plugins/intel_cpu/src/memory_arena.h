@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief A pool of the memory blocks for the dynamic shape edges of a graph.
+ * The block sizes are rounded up to the size classes, so a slightly bigger shape doesn't require a new block.
+ * The released blocks are retained and reused for the next requests, while the total size of the blocks in use and
+ * the retained ones doesn't exceed the high watermark (the peak size of the blocks in use), the other blocks are
+ * returned to the system.
+ * Optionally the big blocks are backed by the transparent huge pages to reduce the TLB misses and page faults.
+ */
+class MemoryArena {
+public:
+    using Ptr = std::shared_ptr<MemoryArena>;
+
+    struct Statistics {
+        uint64_t allocations = 0;    // blocks allocated from the system
+        uint64_t reuses = 0;         // blocks taken from the retained ones
+        uint64_t reallocations = 0;  // memory managers grown to a bigger block
+        uint64_t peakBytes = 0;      // high watermark of the blocks in use
+        uint64_t retainedBytes = 0;  // currently retained blocks
+    };
+
+    explicit MemoryArena(bool useHugePages = false) : _useHugePages(useHugePages) {}
+    ~MemoryArena();
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    /**
+     * @brief Acquires a block of at least the given size
+     * @param size - requested size in bytes
+     * @param capacity - actual size of the block (the size class)
+     * @return pointer to the block
+     */
+    void* acquire(size_t size, size_t& capacity);
+
+    /**
+     * @brief Returns the block acquired from the arena
+     */
+    void release(void* ptr, size_t capacity);
+
+    void countReallocation();
+
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Rounds the size up to the size class: multiple of the cache line for small sizes, a quarter of the power
+     * of two step for the bigger ones, so the rounding overhead doesn't exceed 25%
+     */
+    static size_t sizeClass(size_t size);
+
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+private:
+    void* allocate(size_t capacity);
+    void deallocate(void* ptr);
+    void trim(size_t limit);
+
+    const bool _useHugePages;
+    mutable std::mutex _mutex;
+    std::multimap<size_t, void*> _retained;  // capacity -> block
+    size_t _inUseBytes = 0;
+    Statistics _stat;
+};
+
+/**
+ * @brief An implementation of the mem manager which takes the memory from the arena, the reallocation occurs only if
+ * a bigger buffer than the current size class is requested.
+ */
+class MemoryMngrWithArena : public IMemoryMngr {
+public:
+    explicit MemoryMngrWithArena(MemoryArena::Ptr arena) : _arena(std::move(arena)) {}
+    ~MemoryMngrWithArena() override;
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    void releaseBlock();
+
+    MemoryArena::Ptr _arena;
+    void* _data = nullptr;
+    void* _block = nullptr;
+    size_t _blockCapacity = 0ul;
+    size_t _memUpperBound = 0ul;
+    bool _useExternalStorage = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -15,6 +15,20 @@ void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState || newState->byteSize() != state->byteSize()) {
+        IE_THROW() << "Variable state " << name << ": the new state size doesn't match the size of the variable";
+    }
+    // the state is copied, as the inference reads and writes only its own buffers
+    cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto snapshot = make_blob_with_precision(state->getTensorDesc());
+    snapshot->allocate();
+    cpu_memcpy(snapshot->buffer(), state->cbuffer().as<const void*>(), state->byteSize());
+    return snapshot;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -15,16 +15,39 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state is kept in two buffers: the current one is read by the inference, the next one is written by
+ * the inference and becomes current after it, so no copies are needed between the inferences. GetState() returns
+ * a copy of the current buffer, as both buffers are overwritten by the following inferences.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
     VariableState(std::string name, MemoryPtr storage)
         : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+        const auto desc = MemoryDescUtils::convertToTensorDesc(storage->getDesc());
+        state = make_blob_with_precision(desc);
         state->allocate();
         cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        nextState = make_blob_with_precision(desc);
+        nextState->allocate();
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    void* getCurrentData() const {
+        return state->buffer().as<void*>();
+    }
+    void* getNextData() const {
+        return nextState->buffer().as<void*>();
+    }
+    void swapBuffers() {
+        std::swap(state, nextState);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr nextState;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_preprocessing.hpp"
+
+#include <algorithm>
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+#include "op/fused_preprocess.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Node> get_single_consumer(const ov::Output<ov::Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+        return nullptr;
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+// Returns per channel values of the constant that is broadcasted along the channel axis of a 4D image
+bool get_channel_values(const std::shared_ptr<ov::Node>& node, size_t channel_axis, std::vector<float>& values) {
+    const auto constant = ov::as_type_ptr<ov::opset8::Constant>(node);
+    if (!constant || constant->get_element_type() != ov::element::f32)
+        return false;
+    const auto& shape = constant->get_shape();
+    if (shape.size() > 4)
+        return false;
+    const auto elements = ov::shape_size(shape);
+    if (elements == 3) {
+        const size_t axis_from_end = 4 - channel_axis;
+        if (shape.size() < axis_from_end || shape[shape.size() - axis_from_end] != 3)
+            return false;
+    } else if (elements != 1) {
+        return false;
+    }
+    const auto data = constant->cast_vector<float>();
+    values = elements == 1 ? std::vector<float>(3, data[0]) : data;
+    return true;
+}
+
+bool is_bilinear_resize(const std::shared_ptr<ov::opset8::Interpolate>& interpolate, bool planar) {
+    using Interpolate = ov::opset8::Interpolate;
+    const auto& attrs = interpolate->get_attrs();
+    if (attrs.mode != Interpolate::InterpolateMode::LINEAR ||
+        attrs.shape_calculation_mode != Interpolate::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Interpolate::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.antialias)
+        return false;
+    const auto zero_pad = [](const std::vector<size_t>& pads) {
+        return std::all_of(pads.begin(), pads.end(), [](size_t pad) { return pad == 0; });
+    };
+    if (!zero_pad(attrs.pads_begin) || !zero_pad(attrs.pads_end))
+        return false;
+    if (interpolate->get_input_size() != 4)
+        return false;
+    const auto axes = ov::as_type_ptr<ov::opset8::Constant>(interpolate->get_input_node_shared_ptr(3));
+    if (!axes)
+        return false;
+    const auto expected_axes = planar ? std::vector<int64_t>{2, 3} : std::vector<int64_t>{1, 2};
+    if (axes->cast_vector<int64_t>() != expected_axes)
+        return false;
+    const auto& output_shape = interpolate->get_output_partial_shape(0);
+    return output_shape.rank().is_static() && output_shape[expected_axes[0]].is_static() &&
+           output_shape[expected_axes[1]].is_static();
+}
+
+}  // namespace
+
+ov::intel_cpu::FusePreprocessing::FusePreprocessing() {
+    MATCHER_SCOPE(FusePreprocessing);
+    using namespace ov::pass::pattern;
+    auto color_convert_m = wrap_type<ov::opset8::NV12toRGB, ov::opset8::NV12toBGR,
+                                     ov::opset8::I420toRGB, ov::opset8::I420toBGR>();
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto color_convert = m.get_match_root();
+        if (transformation_callback(color_convert))
+            return false;
+
+        FusedPreprocessNode::Attributes attrs;
+        attrs.i420 = ov::is_type<ov::opset8::I420toRGB>(color_convert) || ov::is_type<ov::opset8::I420toBGR>(color_convert);
+        attrs.bgr = ov::is_type<ov::opset8::NV12toBGR>(color_convert) || ov::is_type<ov::opset8::I420toBGR>(color_convert);
+        attrs.round_rgb = color_convert->get_output_element_type(0).is_integral();
+        attrs.scale = {1.f, 1.f, 1.f};
+        attrs.shift = {0.f, 0.f, 0.f};
+
+        // u8 -> f32 conversion of the planes is exact, so the kernel reads the original u8 planes
+        OutputVector planes = color_convert->input_values();
+        const auto plane_type = planes[0].get_element_type();
+        if (plane_type != ov::element::u8 && plane_type != ov::element::f32)
+            return false;
+        const bool strip_converts = std::all_of(planes.begin(), planes.end(), [](const Output<Node>& plane) {
+            const auto convert = ov::as_type_ptr<ov::opset8::Convert>(plane.get_node_shared_ptr());
+            return convert && convert->get_input_element_type(0) == ov::element::u8;
+        });
+        if (strip_converts) {
+            for (auto& plane : planes)
+                plane = plane.get_node_shared_ptr()->input_value(0);
+        }
+
+        NodeVector fused_nodes{color_convert};
+        auto last = color_convert;
+        if (last->get_output_element_type(0) != ov::element::f32) {
+            const auto convert = ov::as_type_ptr<ov::opset8::Convert>(get_single_consumer(last->output(0)));
+            if (!convert || convert->get_destination_type() != ov::element::f32)
+                return false;
+            fused_nodes.push_back(convert);
+            last = convert;
+        }
+
+        bool resized = false;
+        while (const auto next = get_single_consumer(last->output(0))) {
+            const size_t channel_axis = attrs.planar ? 1 : 3;
+            std::vector<float> values;
+            if (ov::is_type<ov::opset8::Subtract>(next) || ov::is_type<ov::opset8::Add>(next)) {
+                if (!get_channel_values(next->get_input_node_shared_ptr(1), channel_axis, values))
+                    break;
+                const float sign = ov::is_type<ov::opset8::Subtract>(next) ? -1.f : 1.f;
+                for (size_t c = 0; c < 3; c++)
+                    attrs.shift[c] += sign * values[c];
+            } else if (ov::is_type<ov::opset8::Multiply>(next) || ov::is_type<ov::opset8::Divide>(next)) {
+                if (!get_channel_values(next->get_input_node_shared_ptr(1), channel_axis, values))
+                    break;
+                const bool divide = ov::is_type<ov::opset8::Divide>(next);
+                for (size_t c = 0; c < 3; c++) {
+                    const float factor = divide ? 1.f / values[c] : values[c];
+                    attrs.scale[c] *= factor;
+                    attrs.shift[c] *= factor;
+                }
+            } else if (const auto interpolate = ov::as_type_ptr<ov::opset8::Interpolate>(next)) {
+                // the normalization is linear, so it doesn't matter whether it goes before or after the resize
+                if (resized || !is_bilinear_resize(interpolate, attrs.planar))
+                    break;
+                const auto& output_shape = interpolate->get_output_partial_shape(0);
+                const size_t h_axis = attrs.planar ? 2 : 1;
+                attrs.output_size = {output_shape[h_axis].get_length(), output_shape[h_axis + 1].get_length()};
+                resized = true;
+            } else if (const auto transpose = ov::as_type_ptr<ov::opset8::Transpose>(next)) {
+                const auto order = ov::as_type_ptr<ov::opset8::Constant>(transpose->get_input_node_shared_ptr(1));
+                if (attrs.planar || !order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+                    break;
+                attrs.planar = true;
+            } else {
+                break;
+            }
+            fused_nodes.push_back(next);
+            last = next;
+        }
+
+        // color conversion alone is handled by ColorConvert node
+        if (fused_nodes.size() == 1)
+            return false;
+
+        auto fused = std::make_shared<FusedPreprocessNode>(planes, attrs);
+        fused->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, fused);
+        ov::replace_node(last, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(color_convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
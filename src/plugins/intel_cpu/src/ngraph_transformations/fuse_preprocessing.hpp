@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Fuses the image preprocessing subgraph produced by ov::preprocess::PrePostProcessor into FusedPreprocessNode,
+ *     so the CPU plugin makes a single pass over the image instead of running each step as a separate node:
+ *
+ *     NV12toRGB/NV12toBGR/I420toRGB/I420toBGR
+ *         -> [Convert to f32]
+ *         -> [Interpolate (linear, half_pixel) over H and W]
+ *         -> [Subtract/Divide/Multiply/Add by per channel constants]
+ *         -> [Transpose NHWC -> NCHW]
+ *
+ *     The resize, the normalization and the layout change are optional and may follow in any order
+ *     (the normalization commutes with the linear resize), the output must be f32.
+ */
+class FusePreprocessing: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FusePreprocessing", "0");
+    FusePreprocessing();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::FusedPreprocessNode::FusedPreprocessNode(const OutputVector& planes, const Attributes& attrs) :
+    Op(planes), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::FusedPreprocessNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::FusedPreprocessNode>(new_args, m_attrs);
+}
+
+void ov::intel_cpu::FusedPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_validate_and_infer_types);
+    const auto planes = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        planes == 1 || planes == (m_attrs.i420 ? 3 : 2),
+        "unexpected number of image planes: ", planes);
+    NODE_VALIDATION_CHECK(this,
+        m_attrs.output_size.empty() || m_attrs.output_size.size() == 2,
+        "output size must contain height and width");
+    NODE_VALIDATION_CHECK(this,
+        m_attrs.scale.size() == 3 && m_attrs.shift.size() == 3,
+        "scale and shift must be specified per channel");
+    for (size_t i = 0; i < planes; i++) {
+        const auto& pshape = get_input_partial_shape(i);
+        NODE_VALIDATION_CHECK(this,
+            pshape.rank().compatible(4),
+            "image planes must have NHWC layout");
+        NODE_VALIDATION_CHECK(this,
+            get_input_element_type(i) == ngraph::element::u8 || get_input_element_type(i) == ngraph::element::f32,
+            "image planes must be u8 or f32");
+    }
+
+    const auto& y_pshape = get_input_partial_shape(0);
+    auto batch = Dimension::dynamic();
+    auto height = Dimension::dynamic();
+    auto width = Dimension::dynamic();
+    if (y_pshape.rank().is_static()) {
+        batch = y_pshape[0];
+        width = y_pshape[2];
+        if (planes > 1) {
+            height = y_pshape[1];
+        } else if (y_pshape[1].is_static()) {
+            height = y_pshape[1].get_length() * 2 / 3;
+        }
+    }
+    if (!m_attrs.output_size.empty()) {
+        height = m_attrs.output_size[0];
+        width = m_attrs.output_size[1];
+    }
+
+    const auto output_shape = m_attrs.planar ? ov::PartialShape{batch, 3, height, width}
+                                             : ov::PartialShape{batch, height, width, 3};
+    set_output_type(0, ngraph::element::f32, output_shape);
+}
+
+bool ov::intel_cpu::FusedPreprocessNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_visit_attributes);
+    visitor.on_attribute("i420", m_attrs.i420);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("round_rgb", m_attrs.round_rgb);
+    visitor.on_attribute("planar", m_attrs.planar);
+    visitor.on_attribute("output_size", m_attrs.output_size);
+    visitor.on_attribute("scale", m_attrs.scale);
+    visitor.on_attribute("shift", m_attrs.shift);
+    return true;
+}
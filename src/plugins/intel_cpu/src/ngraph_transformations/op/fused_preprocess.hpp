@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Image preprocessing fused into a single operation:
+ * NV12/I420 -> RGB/BGR color conversion, optional bilinear resize (half_pixel), per channel normalization
+ * (out = in * scale + shift) and optional NHWC -> NCHW layout change.
+ * Inputs are the image planes in the layout of the corresponding color conversion operation, output is f32.
+ */
+class FusedPreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FusedPreprocess", "cpu_plugin_opset");
+
+    struct Attributes {
+        bool i420 = false;              // false - NV12 (interleaved UV), true - I420 (separate U and V)
+        bool bgr = false;               // output channels order
+        bool round_rgb = false;         // color conversion result is rounded to integers as for u8 output
+        bool planar = false;            // false - NHWC output, true - NCHW output
+        std::vector<int64_t> output_size;   // {H, W} of the resized image, empty if there is no resize
+        std::vector<float> scale;       // per output channel
+        std::vector<float> shift;       // per output channel
+    };
+
+    FusedPreprocessNode() = default;
+
+    FusedPreprocessNode(const OutputVector& planes, const Attributes& attrs);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+
+private:
+    Attributes m_attrs;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
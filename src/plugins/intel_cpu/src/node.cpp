@@ -60,6 +60,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <openvino/core/compilation_profile.hpp>
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 
@@ -798,6 +799,7 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
         const auto &internalBlob = internalBlobs[i];
 
         auto create = [&] () {
+            ov::CompilationProfile::Stage profileStage("weights_reorder", getName());
             // TODO [DS]: internal blobs should be removed or rewritten using Memory object
             auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
@@ -341,6 +341,13 @@ public:
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
     bool outputShapeDataDependency() const;
+    /**
+     * @brief Whether the output shapes are defined by the input shapes only, so the result of the shape inference
+     * may be reused for the same input shapes instead of calling shapeInfer() once again
+     */
+    virtual bool isShapeInferReplayable() const {
+        return !outputShapeDataDependency();
+    }
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -700,7 +707,7 @@ protected:
 
     MemoryPtr getScratchPadMem(const const_dnnl_primitive_desc_t& pd) {
         auto scratchpadMemoryDesc = DnnlExtensionUtils::query_md(pd, dnnl::query::scratchpad_md);
-        scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchpadMemoryDesc);
+        scratchpadMem = context->getScratchPad(interOpBranch)->createScratchPadMem(scratchpadMemoryDesc);
         return scratchpadMem;
     }
 
@@ -723,6 +730,8 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    // index of the branch inside the inter-op parallel stage (see Graph::InitInterOpStages)
+    int interOpBranch = 0;
 
     std::string typeToStr(Type type);
 
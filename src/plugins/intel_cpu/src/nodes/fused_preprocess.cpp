@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <ie/ie_parallel.hpp>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool FusedPreprocess::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const FusedPreprocessNode>(op)) {
+            errorMessage = "Only FusedPreprocess operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+FusedPreprocess::FusedPreprocess(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "FusedPreprocess node with name '" + getName() + "'";
+    attrs = std::dynamic_pointer_cast<const FusedPreprocessNode>(op)->get_attrs();
+    channelOrder = attrs.bgr ? std::array<size_t, 3>{2, 1, 0} : std::array<size_t, 3>{0, 1, 2};
+}
+
+void FusedPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    inputPrecision = getOriginalInputPrecisionAtPort(0) == Precision::U8 ? Precision::U8 : Precision::FP32;
+
+    addSupportedPrimDesc(std::vector<PortConfigurator>(getOriginalInputsNumber(), {LayoutType::ncsp, inputPrecision}),
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void FusedPreprocess::AxisCoefficients::init(size_t srcSize, size_t dstSize) {
+    idx0.resize(dstSize);
+    idx1.resize(dstSize);
+    weight.resize(dstSize);
+    const float scale = static_cast<float>(dstSize) / srcSize;
+    for (size_t i = 0; i < dstSize; i++) {
+        // half_pixel coordinate transformation, the neighbours outside of the image are skipped by Interpolate,
+        // which is the same as clamping the source coordinate
+        float src = (static_cast<float>(i) + 0.5f) / scale - 0.5f;
+        src = std::min(std::max(src, 0.f), static_cast<float>(srcSize - 1));
+        idx0[i] = static_cast<size_t>(src);
+        idx1[i] = std::min(idx0[i] + 1, srcSize - 1);
+        weight[i] = src - idx0[i];
+    }
+}
+
+void FusedPreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    if (srcDims.size() != 4 || dstDims.size() != 4)
+        IE_THROW() << errorPrefix << " has incorrect input/output dimensions";
+
+    batch = srcDims[0];
+    srcHeight = getOriginalInputsNumber() == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    srcWidth = srcDims[2];
+    dstHeight = attrs.planar ? dstDims[2] : dstDims[1];
+    dstWidth = attrs.planar ? dstDims[3] : dstDims[2];
+
+    if (!attrs.output_size.empty()) {
+        if (srcHeight == 0 || srcWidth == 0)
+            IE_THROW() << errorPrefix << " can't resize an empty image";
+        rows.init(srcHeight, dstHeight);
+        cols.init(srcWidth, dstWidth);
+    }
+}
+
+template <typename T>
+void FusedPreprocess::executeImpl() {
+    const auto* y = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t srcImageSize = srcHeight * srcWidth;
+    const size_t uvRowStride = attrs.i420 ? srcWidth / 2 : srcWidth;
+    const size_t uvStep = attrs.i420 ? 1 : 2;
+    const T* u = nullptr;
+    const T* v = nullptr;
+    size_t yBatchStride = 0;
+    size_t uvBatchStride = 0;
+    if (getOriginalInputsNumber() == 1) {
+        yBatchStride = uvBatchStride = srcImageSize * 3 / 2;
+        u = y + srcImageSize;
+        v = attrs.i420 ? y + srcImageSize * 5 / 4 : u + 1;
+    } else {
+        yBatchStride = srcImageSize;
+        u = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        if (attrs.i420) {
+            v = reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+            uvBatchStride = srcImageSize / 4;
+        } else {
+            v = u + 1;
+            uvBatchStride = srcImageSize / 2;
+        }
+    }
+
+    // the same formula as ColorConvert uses, the rounding reproduces u8 output of the color conversion
+    const bool round = attrs.round_rgb;
+    auto clip = [round](float a) {
+        a = std::min(std::max(a, 0.f), 255.f);
+        return round ? std::round(a) : a;
+    };
+    auto toRgb = [&](const T* yPtr, const T* uPtr, const T* vPtr, size_t h, size_t w, float* rgb) {
+        const float c = static_cast<float>(yPtr[h * srcWidth + w]) - 16.f;
+        const size_t uvIdx = (h / 2) * uvRowStride + (w / 2) * uvStep;
+        const float d = static_cast<float>(uPtr[uvIdx]) - 128.f;
+        const float e = static_cast<float>(vPtr[uvIdx]) - 128.f;
+        rgb[0] = clip(1.164f * c + 1.596f * e);
+        rgb[1] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+        rgb[2] = clip(1.164f * c + 2.018f * d);
+    };
+
+    const bool resize = !attrs.output_size.empty();
+    const size_t dstImageSize = dstHeight * dstWidth;
+    parallel_for2d(batch, dstHeight, [&](size_t b, size_t oh) {
+        const T* yPtr = y + b * yBatchStride;
+        const T* uPtr = u + b * uvBatchStride;
+        const T* vPtr = v + b * uvBatchStride;
+        float* out = dst + b * dstImageSize * 3;
+
+        for (size_t ow = 0; ow < dstWidth; ow++) {
+            float rgb[3];
+            if (resize) {
+                // the color conversion is not linear because of clipping, so it is done before the interpolation
+                float p00[3], p01[3], p10[3], p11[3];
+                toRgb(yPtr, uPtr, vPtr, rows.idx0[oh], cols.idx0[ow], p00);
+                toRgb(yPtr, uPtr, vPtr, rows.idx0[oh], cols.idx1[ow], p01);
+                toRgb(yPtr, uPtr, vPtr, rows.idx1[oh], cols.idx0[ow], p10);
+                toRgb(yPtr, uPtr, vPtr, rows.idx1[oh], cols.idx1[ow], p11);
+                const float wy = rows.weight[oh];
+                const float wx = cols.weight[ow];
+                for (size_t c = 0; c < 3; c++) {
+                    const float top = p00[c] + (p01[c] - p00[c]) * wx;
+                    const float bottom = p10[c] + (p11[c] - p10[c]) * wx;
+                    rgb[c] = top + (bottom - top) * wy;
+                }
+            } else {
+                toRgb(yPtr, uPtr, vPtr, oh, ow, rgb);
+            }
+
+            for (size_t c = 0; c < 3; c++) {
+                const float value = rgb[channelOrder[c]] * attrs.scale[c] + attrs.shift[c];
+                if (attrs.planar) {
+                    out[c * dstImageSize + oh * dstWidth + ow] = value;
+                } else {
+                    out[(oh * dstWidth + ow) * 3 + c] = value;
+                }
+            }
+        }
+    });
+}
+
+void FusedPreprocess::execute(dnnl::stream strm) {
+    if (inputPrecision == Precision::U8) {
+        executeImpl<uint8_t>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+bool FusedPreprocess::created() const {
+    return getType() == Type::FusedPreprocess;
+}
+
+void FusedPreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
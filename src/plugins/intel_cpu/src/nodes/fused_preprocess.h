@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph_transformations/op/fused_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Color conversion, bilinear resize, normalization and layout change of an NV12/I420 image in a single pass:
+ * every output pixel is computed from the source pixels it depends on, so there are no intermediate RGB or
+ * resized images in memory.
+ */
+class FusedPreprocess : public Node {
+public:
+    FusedPreprocess(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // Source coordinates of the output pixels along one axis: out[i] = src[idx0[i]] * (1 - weight[i]) + src[idx1[i]] * weight[i]
+    struct AxisCoefficients {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> weight;
+
+        void init(size_t srcSize, size_t dstSize);
+    };
+
+    template <typename T>
+    void executeImpl();
+
+    FusedPreprocessNode::Attributes attrs;
+    std::array<size_t, 3> channelOrder;     // index of the output channel in {r, g, b}
+    InferenceEngine::Precision inputPrecision;
+
+    size_t batch = 0;
+    size_t srcHeight = 0;
+    size_t srcWidth = 0;
+    size_t dstHeight = 0;
+    size_t dstWidth = 0;
+    AxisCoefficients rows;
+    AxisCoefficients cols;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -123,12 +123,19 @@ void Gather::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // The reorder of the state rows (e.g. the beam reorder of the cached keys and values) is executed in place:
+    // the output has the same shape as the data and the rows along the axis are contiguous.
+    const auto& dataParent = getParentEdgeAt(GATHER_DATA)->getParent();
+    const bool canBeInPlace = !isDynamicNode() && isAxisInputConst && batchDims == 0 && beforeAxisSize == 1 &&
+                              specIndicesSize == static_cast<uint64_t>(axisDim) &&
+                              dataParent->getType() == Type::MemoryInput && dataParent->getChildEdges().size() == 1;
+
     // Implementation desc type will be redefined in the fn prepareParams if a kernel will be created.
     Precision dataPrecision = getOriginalInputPrecisionAtPort(GATHER_DATA);
-    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision, false, canBeInPlace ? 0 : -1},
                           {LayoutType::ncsp, Precision::I32},
                           {LayoutType::ncsp, Precision::I32, isAxisInputConst}},
-                         {{LayoutType::ncsp, dataPrecision}},
+                         {{LayoutType::ncsp, dataPrecision, false, canBeInPlace ? 0 : -1}},
                          ref_any,
                          isDynamicNode());
 }
@@ -265,6 +272,10 @@ void Gather::prepareParams() {
 }
 
 void Gather::execute(dnnl::stream strm) {
+    if (getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr() == getChildEdgeAt(0)->getMemoryPtr()->GetPtr()) {
+        execInPlace();
+        return;
+    }
     if (jitKernel && jitKernel->isSupportedConfiguration(afterAxisSize)) {
         const void* srcIndices = getParentEdgeAt(GATHER_INDICES)->getMemoryPtr()->GetPtr();
         const void* srcData = getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr();
@@ -475,6 +486,55 @@ void Gather::execReference() {
     });
 }
 
+void Gather::execInPlace() {
+    // Only the rows whose index differs from their position are written. The rows which are read by the other ones
+    // and overwritten themselves are stashed before, the rest of the sources are read in place.
+    const int32_t* srcIndices = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDICES)->getMemoryPtr()->GetPtr());
+    uint8_t* data = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t rowsNum = static_cast<size_t>(axisDim);
+    const size_t rowSize = afterAxisSizeInBytes;
+
+    // -1 marks the rows filled by zeros (the index is out of range)
+    std::vector<int> rowSource(rowsNum);
+    std::vector<size_t> changedRows;
+    for (size_t j = 0; j < rowsNum; j++) {
+        int ii = srcIndices[j];
+        if (ii < 0 && reverseIndexing)
+            ii += axisDim;
+        rowSource[j] = (ii < 0 || ii >= axisDim) ? -1 : ii;
+        if (rowSource[j] != static_cast<int>(j))
+            changedRows.push_back(j);
+    }
+    if (changedRows.empty())
+        return;
+
+    std::vector<size_t> stashPos(rowsNum, rowsNum);
+    std::vector<size_t> stashedRows;
+    for (auto j : changedRows) {
+        const int src = rowSource[j];
+        if (src >= 0 && rowSource[src] != src && stashPos[src] == rowsNum) {
+            stashPos[src] = stashedRows.size();
+            stashedRows.push_back(src);
+        }
+    }
+    inPlaceStash.resize(stashedRows.size() * rowSize);
+    parallel_for(stashedRows.size(), [&](size_t i) {
+        cpu_memcpy(&inPlaceStash[i * rowSize], &data[stashedRows[i] * rowSize], rowSize);
+    });
+
+    parallel_for(changedRows.size(), [&](size_t i) {
+        const size_t j = changedRows[i];
+        const int src = rowSource[j];
+        if (src < 0) {
+            memset(&data[j * rowSize], 0, rowSize);
+        } else if (stashPos[src] != rowsNum) {
+            cpu_memcpy(&data[j * rowSize], &inPlaceStash[stashPos[src] * rowSize], rowSize);
+        } else {
+            cpu_memcpy(&data[j * rowSize], &data[src * rowSize], rowSize);
+        }
+    });
+}
+
 bool Gather::created() const {
     return getType() == Type::Gather;
 }
@@ -53,6 +53,7 @@ protected:
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
+    void execInPlace();
 
     bool isDataShapeStat = false;
     bool isIdxShapeStat = false;
@@ -79,6 +80,7 @@ private:
     uint64_t totalWork = 0lu;
 
     std::vector<threadExecParams> execParamsPerThread;
+    std::vector<uint8_t> inPlaceStash;
 
     static constexpr size_t GATHER_DATA = 0;
     static constexpr size_t GATHER_INDICES = 1;
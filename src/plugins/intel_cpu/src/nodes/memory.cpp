@@ -3,9 +3,11 @@
 //
 
 #include <string>
+#include <unordered_set>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
@@ -150,6 +152,80 @@ static void simple_copy(const Memory& dst, const Memory& src) {
     }
 }
 
+/**
+ * Checks that the memory of the edges may be replaced by the external buffer of the given layout.
+ * The rules are the same as for the memory of the graph inputs (see InferRequestBase::changeDefaultPtr):
+ * the memory mustn't be shared by the children with the other edges.
+ */
+static bool canRedirectEdges(const std::vector<EdgePtr>& edges, const MemoryDesc& desc) {
+    for (const auto& edge : edges) {
+        if (!edge->getMemory().getDesc().isCompatible(desc))
+            return false;
+
+        const auto& child = edge->getChild();
+        if (child->isConstant() || child->isInPlace() || one_of(child->getType(), Type::Output, Type::Split))
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        for (const auto& childEdge : child->getChildEdges()) {
+            auto e = childEdge.lock();
+            if (!e || e->getMemory().GetData() == edge->getMemory().GetData())
+                return false;
+        }
+    }
+    return !edges.empty();
+}
+
+/**
+ * Collects the edges sharing the memory with the given ones through the in-place children.
+ * Fails if a child takes a part of the memory as a view (the view can't follow the redirected memory)
+ * or the memory goes to the graph outputs.
+ */
+static bool collectSharedEdges(const std::vector<EdgePtr>& rootEdges, std::vector<EdgePtr>& sharedEdges) {
+    const auto& rootMemory = rootEdges.front()->getMemory();
+    const auto begin = static_cast<const uint8_t*>(rootMemory.GetData());
+    const auto end = begin + rootMemory.GetSize();
+
+    std::vector<EdgePtr> toVisit = rootEdges;
+    std::unordered_set<const Edge*> visited;
+    while (!toVisit.empty()) {
+        const auto edge = toVisit.back();
+        toVisit.pop_back();
+        if (!visited.insert(edge.get()).second)
+            continue;
+
+        if (edge->getMemory().GetData() != begin || edge->getMemory().GetSize() > rootMemory.GetSize())
+            return false;
+        const auto& child = edge->getChild();
+        if (child->isConstant() || child->isDynamicNode() || one_of(child->getType(), Type::Output, Type::Split))
+            return false;
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+        sharedEdges.push_back(edge);
+
+        for (const auto& childEdge : child->getChildEdges()) {
+            auto e = childEdge.lock();
+            if (!e)
+                return false;
+            const auto data = static_cast<const uint8_t*>(e->getMemory().GetData());
+            if (data == begin) {
+                toVisit.push_back(e);
+            } else if (data > begin && data < end) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 MemoryInput::~MemoryInput() {
     MemoryNodeVirtualEdge::remove(this, holder);
 }
@@ -158,18 +234,95 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::initZeroCopy() {
+    zeroCopyChecked = true;
+    const auto& stateDesc = dataStore->getDesc();
+
+    const auto readEdges = getChildEdgesAtPort(0);
+    const auto assignEdge = outputNode ? outputNode->getParentEdgeAt(0) : nullptr;
+
+    // The state is updated in place: the in-place nodes between the ReadValue and the Assign (e.g. ScatterUpdate
+    // writing the new rows into the reserved state or Gather reordering the rows) share the memory, so all the edges
+    // of this memory work with the current state buffer directly and it stays current after the inference.
+    if (assignEdge && !readEdges.empty() && assignEdge->getMemory().GetData() == readEdges.front()->getMemory().GetData()) {
+        std::vector<EdgePtr> sharedEdges;
+        if (readEdges.front()->getMemory().getDesc().isCompatible(stateDesc) &&
+            collectSharedEdges(readEdges, sharedEdges)) {
+            currentStateEdges = sharedEdges;
+        }
+        return;
+    }
+
+    // ReadValue: the consumers read the current state buffer
+    if (canRedirectEdges(readEdges, stateDesc)) {
+        currentStateEdges = readEdges;
+    }
+
+    // Assign: the producer of the new value writes it right into the next state buffer
+    if (!assignEdge)
+        return;
+    const auto& producer = assignEdge->getParent();
+    if (producer->isConstant() || producer->isInPlace() || producer->isDynamicNode() ||
+        one_of(producer->getType(), Type::Input, Type::MemoryInput))
+        return;
+    for (const auto& parentEdge : producer->getParentEdges()) {
+        auto e = parentEdge.lock();
+        if (!e || e->getMemory().GetData() == assignEdge->getMemory().GetData())
+            return;
+    }
+    const auto writeEdges = producer->getChildEdgesAtPort(static_cast<size_t>(assignEdge->getInputNum()));
+    if (canRedirectEdges(writeEdges, stateDesc)) {
+        nextStateEdges = writeEdges;
+    }
+}
+
+void MemoryInput::setStateBuffers(void* current, void* next) {
+    if (!zeroCopyChecked) {
+        initZeroCopy();
+    }
+
+    if (!currentState) {
+        currentState = std::make_shared<Memory>(getEngine());
+        currentState->Create(dataStore->getDescPtr(), current);
+        nextState = std::make_shared<Memory>(getEngine());
+        nextState->Create(dataStore->getDescPtr(), next);
+    } else {
+        currentState->setDataHandle(current);
+        nextState->setDataHandle(next);
+    }
+    stateBound = true;
+    nextStateWritten = false;
+
+    for (const auto& edge : currentStateEdges) {
+        edge->getMemoryPtr()->setDataHandle(current);
+    }
+    for (const auto& edge : nextStateEdges) {
+        edge->getMemoryPtr()->setDataHandle(next);
+    }
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    if (!stateBound) {
+        simple_copy(*dataStore, new_state);
+        return;
+    }
+    // the ReadValue output is assigned as is
+    if (new_state.GetData() == currentState->GetData())
+        return;
+    // the new value is copied only if the producer doesn't write it into the next state buffer
+    if (new_state.GetData() != nextState->GetData()) {
+        simple_copy(*nextState, new_state);
+    }
+    nextStateWritten = true;
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    const auto& state = stateBound ? currentState : dataStore;
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the consumers read the state buffer directly if the edges are redirected to it
+    if (dstMemory.GetData() != state->GetData()) {
+        simple_copy(dstMemory, *state);
+    }
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -181,6 +334,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput
         auto outputNode = dynamic_cast<MemoryOutput*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -196,6 +350,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerOutput(MemoryOutpu
         auto inputNode = dynamic_cast<MemoryInput*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
@@ -12,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -101,10 +102,40 @@ public:
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
+
+    /**
+     * @brief Binds the state buffers of an infer request: the ReadValue reads the current buffer and the Assign
+     * writes the next one. Where the graph allows, the edges of the state memory are redirected to the buffers,
+     * so the state is passed between the inferences without copying.
+     * @param current the buffer of the current state value
+     * @param next the buffer for the new state value, it becomes current after the inference if isNextStateWritten()
+     */
+    void setStateBuffers(void* current, void* next);
+    bool isNextStateWritten() const {
+        return nextStateWritten;
+    }
+
     void storeState(const Memory& mem);
     MemoryPtr getStore();
  private:
+    void initZeroCopy();
+
+    // initial state value, it is also used as the state storage if no state buffers are bound
     MemoryPtr dataStore;
+    MemoryPtr currentState;
+    MemoryPtr nextState;
+    bool stateBound = false;
+    bool nextStateWritten = false;
+
+    // the edges whose memory is redirected to the current and the next state buffers
+    bool zeroCopyChecked = false;
+    std::vector<EdgePtr> currentStateEdges;
+    std::vector<EdgePtr> nextStateEdges;
+
+    MemoryOutput* outputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
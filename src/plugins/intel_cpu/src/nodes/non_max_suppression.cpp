@@ -552,6 +552,8 @@ private:
     }
 };
 
+constexpr size_t NonMaxSuppression::intraClassTileSize;
+
 bool NonMaxSuppression::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         // TODO [DS NMS]: remove when nodes from models where nms is not last node in model supports DS
@@ -993,7 +995,10 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
 void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
     int max_out_box = static_cast<int>(maxOutputBoxesPerClass);
-    parallel_for2d(numBatches, numClasses, [&](int batch_idx, int class_idx) {
+    // with a few (batch, class) pairs most of the threads would be idle, so the suppression within a class is parallelized too
+    const bool parallelWithinClass = numBatches * numClasses < static_cast<size_t>(parallel_get_max_threads()) &&
+                                     numBoxes > intraClassTileSize;
+    auto nmsClass = [&](int batch_idx, int class_idx) {
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
@@ -1011,6 +1016,10 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                               return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                           });
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
+            if (parallelWithinClass && sortedBoxSize > intraClassTileSize) {
+                numFiltBox[batch_idx][class_idx] = suppressByTiles(boxesPtr, sorted_boxes, batch_idx, class_idx, &filtBoxes[offset]);
+                return;
+            }
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
             if (sortedBoxSize > 1) {
@@ -1074,7 +1083,75 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         }
 
         numFiltBox[batch_idx][class_idx] = io_selection_size;
-    });
+    };
+
+    // the tiles of a class are processed by the nested parallel_for, as the sorting of the boxes is
+    parallel_for2d(numBatches, numClasses, nmsClass);
+}
+
+size_t NonMaxSuppression::suppressByTiles(const float *boxesPtr, const std::vector<std::pair<float, int>> &sortedBoxes,
+                                          int batchIdx, int classIdx, filteredBoxes *selectedBoxes) {
+    const size_t sortedBoxSize = sortedBoxes.size();
+    const size_t maxSelectedBoxNum = std::min(sortedBoxSize, maxOutputBoxesPerClass);
+
+    // coordinates of the selected boxes, the layout the jit kernel expects
+    std::vector<float> boxCoord0(maxSelectedBoxNum), boxCoord1(maxSelectedBoxNum), boxCoord2(maxSelectedBoxNum), boxCoord3(maxSelectedBoxNum);
+    std::vector<char> suppressed(intraClassTileSize);
+
+    // checks the candidate against the selected boxes [begin, end)
+    auto isSuppressed = [&](int boxIdx, size_t begin, size_t end) {
+        if (begin >= end)
+            return false;
+        const float *candidateBox = &boxesPtr[boxIdx * 4];
+        if (nms_kernel) {
+            int candidateStatus = NMSCandidateStatus::SELECTED;
+            auto arg = jit_nms_args();
+            arg.iou_threshold = static_cast<float*>(&iouThreshold);
+            arg.score_threshold = static_cast<float*>(&scoreThreshold);
+            arg.scale = static_cast<float*>(&scale);
+            arg.selected_boxes_num = end - begin;
+            arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[begin]);
+            arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[begin]);
+            arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[begin]);
+            arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[begin]);
+            arg.candidate_box = candidateBox;
+            arg.candidate_status = static_cast<int*>(&candidateStatus);
+            (*nms_kernel)(&arg);
+            return candidateStatus == NMSCandidateStatus::SUPPRESSED;
+        }
+        for (size_t selected_idx = end; selected_idx-- > begin;) {
+            const float selectedBox[4] = {boxCoord0[selected_idx], boxCoord1[selected_idx], boxCoord2[selected_idx], boxCoord3[selected_idx]};
+            if (intersectionOverUnion(candidateBox, selectedBox) >= iouThreshold)
+                return true;
+        }
+        return false;
+    };
+
+    // The greedy algorithm selects a candidate if it doesn't overlap any box selected before it. The candidates are taken
+    // by tiles: the tile is checked against the boxes selected by the previous tiles in parallel, then the survivors are
+    // checked against the boxes selected within the tile in the score order. The result is the same as the sequential one.
+    size_t selectedBoxNum = 0;
+    for (size_t tileBegin = 0; tileBegin < sortedBoxSize && selectedBoxNum < maxSelectedBoxNum; tileBegin += intraClassTileSize) {
+        const size_t tileSize = std::min(intraClassTileSize, sortedBoxSize - tileBegin);
+        const size_t selectedBeforeTile = selectedBoxNum;
+        parallel_for(tileSize, [&](size_t i) {
+            suppressed[i] = isSuppressed(sortedBoxes[tileBegin + i].second, 0, selectedBeforeTile);
+        });
+
+        for (size_t i = 0; i < tileSize && selectedBoxNum < maxSelectedBoxNum; i++) {
+            const auto &candidate = sortedBoxes[tileBegin + i];
+            if (suppressed[i] || isSuppressed(candidate.second, selectedBeforeTile, selectedBoxNum))
+                continue;
+            const float *candidateBox = &boxesPtr[candidate.second * 4];
+            boxCoord0[selectedBoxNum] = candidateBox[0];
+            boxCoord1[selectedBoxNum] = candidateBox[1];
+            boxCoord2[selectedBoxNum] = candidateBox[2];
+            boxCoord3[selectedBoxNum] = candidateBox[3];
+            selectedBoxes[selectedBoxNum] = filteredBoxes(candidate.first, batchIdx, classIdx, candidate.second);
+            selectedBoxNum++;
+        }
+    }
+    return selectedBoxNum;
 }
 
 void NonMaxSuppression::checkPrecision(const Precision& prec, const std::vector<Precision>& precList,
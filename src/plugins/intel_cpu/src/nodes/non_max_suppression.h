@@ -8,6 +8,7 @@
 #include <node.h>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #define BOX_COORD_NUM 4
@@ -97,6 +98,11 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                              const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
+    // hard suppression of the sorted candidates of one (batch, class) pair by tiles processed in parallel,
+    // returns the number of the selected boxes
+    size_t suppressByTiles(const float *boxesPtr, const std::vector<std::pair<float, int>> &sortedBoxes,
+                           int batchIdx, int classIdx, filteredBoxes *selectedBoxes);
+
     void executeDynamicImpl(dnnl::stream strm) override;
 
     bool isExecutable() const override;
@@ -138,6 +144,9 @@ private:
 
     std::string errorPrefix;
 
+    // number of the candidates checked in parallel when the suppression within a class is parallelized
+    static constexpr size_t intraClassTileSize = 256;
+
     std::vector<std::vector<size_t>> numFiltBox;
     const std::string inType = "input", outType = "output";
 
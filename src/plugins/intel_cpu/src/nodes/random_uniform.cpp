@@ -0,0 +1,226 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "random_uniform.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <ie_ngraph_utils.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <openvino/core/type/bfloat16.hpp>
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+
+// Philox4x32-10 constants, must be the same as in the reference implementation (ngraph::runtime::reference)
+constexpr uint32_t crushResistanceConstLower = 0x9E3779B9;
+constexpr uint32_t crushResistanceConstUpper = 0xBB67AE85;
+constexpr uint64_t statisticMaximizingMultiplierN = 0xD2511F53;
+constexpr uint64_t statisticMaximizingMultiplierCounter = 0xCD9E8D57;
+constexpr size_t roundsNumber = 10;
+// how many sequence elements are skipped between the runs
+constexpr uint64_t skipConst = 256;
+
+// each run of Philox generates 4 uint32 values, each of them gives an output element
+constexpr size_t philoxOutputSize = 4;
+// the number of Philox runs processed together: the lanes are independent, so the rounds are vectorized
+constexpr size_t blockSize = 16;
+
+struct PhiloxBlock {
+    uint32_t nLo[blockSize];
+    uint32_t nHi[blockSize];
+    uint32_t counterLo[blockSize];
+    uint32_t counterHi[blockSize];
+};
+
+// Runs Philox for the sequence positions [first, first + size), the position i uses the counters
+// {n + i, counter + carry}, as the reference increments n after each run and the counter on the overflow of n.
+inline void runPhilox(const uint32_t* keyLo, const uint32_t* keyHi, uint64_t counter, uint64_t n,
+                      uint64_t first, size_t size, PhiloxBlock& block) {
+    for (size_t i = 0; i < size; i++) {
+        const uint64_t ni = n + first + i;
+        const uint64_t counteri = counter + (ni < n ? 1 : 0);
+        block.nLo[i] = static_cast<uint32_t>(ni);
+        block.nHi[i] = static_cast<uint32_t>(ni >> 32);
+        block.counterLo[i] = static_cast<uint32_t>(counteri);
+        block.counterHi[i] = static_cast<uint32_t>(counteri >> 32);
+    }
+    for (size_t r = 0; r < roundsNumber; r++) {
+        for (size_t i = 0; i < size; i++) {
+            const uint64_t prodN = statisticMaximizingMultiplierN * block.nLo[i];
+            const uint64_t prodCounter = statisticMaximizingMultiplierCounter * block.counterLo[i];
+            const uint32_t nLo = static_cast<uint32_t>(prodCounter >> 32) ^ block.nHi[i] ^ keyLo[r];
+            const uint32_t counterLo = static_cast<uint32_t>(prodN >> 32) ^ block.counterHi[i] ^ keyHi[r];
+            block.nHi[i] = static_cast<uint32_t>(prodCounter);
+            block.counterHi[i] = static_cast<uint32_t>(prodN);
+            block.nLo[i] = nLo;
+            block.counterLo[i] = counterLo;
+        }
+    }
+}
+
+// The conversions replicate the reference ones exactly (including the arithmetic type), so the results are bit-exact.
+template <typename T>
+struct UniformConverter;
+
+template <>
+struct UniformConverter<float> {
+    UniformConverter(float mn, float mx) : min(mn), max(mx) {}
+    float operator()(uint32_t x) const {
+        // sign = 0, exponent = 127, mantissa = 23 random bits: the value in [1, 2)
+        const uint32_t bits = (static_cast<uint32_t>(127) << 23) | (x & 0x7fffffu);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return (value - 1.0f) * (max - min) + min;
+    }
+    float min, max;
+};
+
+template <>
+struct UniformConverter<ov::bfloat16> {
+    UniformConverter(ov::bfloat16 mn, ov::bfloat16 mx) : min(mn), max(mx) {}
+    ov::bfloat16 operator()(uint32_t x) const {
+        // sign = 0, exponent = 127, mantissa = 7 random bits: the value in [1, 2)
+        const auto x16 = static_cast<uint16_t>(x);
+        const auto value = ov::bfloat16::from_bits(static_cast<uint16_t>((static_cast<uint16_t>(127) << 7) | (x16 & 0x7fu)));
+        return (value - static_cast<ov::bfloat16>(1)) * (max - min) + min;
+    }
+    ov::bfloat16 min, max;
+};
+
+template <>
+struct UniformConverter<int32_t> {
+    UniformConverter(int32_t mn, int32_t mx) : min(mn), max(mx) {}
+    int32_t operator()(uint32_t x) const {
+        return static_cast<int32_t>(x % (max - min) + min);
+    }
+    int32_t min, max;
+};
+
+} // namespace
+
+bool RandomUniform::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<const ngraph::opset8::RandomUniform>(op)) {
+            errorMessage = "Only opset8 RandomUniform operation is supported";
+            return false;
+        }
+        const auto outputType = op->get_output_element_type(0);
+        if (!one_of(outputType, ngraph::element::f32, ngraph::element::bf16, ngraph::element::i32)) {
+            errorMessage = "Unsupported output type: " + outputType.get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+RandomUniform::RandomUniform(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, PortMask(OUT_SHAPE))) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "RandomUniform node with name '" + op->get_friendly_name() + "'";
+    if (getOriginalInputsNumber() != 3 || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto randomUniform = ov::as_type_ptr<const ngraph::opset8::RandomUniform>(op);
+    globalSeed = randomUniform->get_global_seed();
+    opSeed = randomUniform->get_op_seed();
+    state = randomUniform->get_state();
+
+    // RandomUniform generates a new sequence on each inference even if all the inputs are constants
+    constant = ConstantType::NoConst;
+}
+
+void RandomUniform::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::I32},
+                          {LayoutType::ncsp, outputPrecision},
+                          {LayoutType::ncsp, outputPrecision}},
+                         {{LayoutType::ncsp, outputPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+template <typename T>
+void RandomUniform::generate(uint64_t key, uint64_t counter, uint64_t n, size_t elemCount) {
+    const UniformConverter<T> convert(*reinterpret_cast<const T*>(getParentEdgeAt(MIN_VAL)->getMemoryPtr()->GetPtr()),
+                                      *reinterpret_cast<const T*>(getParentEdgeAt(MAX_VAL)->getMemoryPtr()->GetPtr()));
+    T* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    // the key is raised after each round
+    uint32_t keyLo[roundsNumber];
+    uint32_t keyHi[roundsNumber];
+    keyLo[0] = static_cast<uint32_t>(key);
+    keyHi[0] = static_cast<uint32_t>(key >> 32);
+    for (size_t r = 1; r < roundsNumber; r++) {
+        keyLo[r] = keyLo[r - 1] + crushResistanceConstLower;
+        keyHi[r] = keyHi[r - 1] + crushResistanceConstUpper;
+    }
+
+    // the sequence position of each output element is known in advance, so the work is split between the threads
+    const size_t runsNum = (elemCount + philoxOutputSize - 1) / philoxOutputSize;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(runsNum, nthr, ithr, start, end);
+        PhiloxBlock block;
+        for (size_t first = start; first < end; first += blockSize) {
+            const size_t size = std::min(blockSize, end - first);
+            runPhilox(keyLo, keyHi, counter, n, first, size, block);
+            for (size_t i = 0; i < size; i++) {
+                const uint32_t res[philoxOutputSize] = {block.nLo[i], block.nHi[i], block.counterLo[i], block.counterHi[i]};
+                const size_t offset = (first + i) * philoxOutputSize;
+                const size_t count = std::min(philoxOutputSize, elemCount - offset);
+                for (size_t j = 0; j < count; j++) {
+                    dst[offset + j] = convert(res[j]);
+                }
+            }
+        }
+    });
+}
+
+void RandomUniform::execute(dnnl::stream strm) {
+    // When both seeds are equal to zero the sequence is non-deterministic, the same way as in the reference
+    uint64_t key = globalSeed;
+    if (globalSeed == 0 && opSeed == 0) {
+        std::srand(static_cast<unsigned int>(std::time(nullptr)));
+        key = std::rand();
+    }
+    const size_t elemCount = getChildEdgeAt(0)->getMemory().GetShape().getElementsCount();
+
+    RandomUniformContext ctx = {this, key, state.second > 0 ? state.second : opSeed, state.first, elemCount};
+    OV_SWITCH(intel_cpu, RandomUniformExecute, ctx, outputPrecision,
+              OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, ov::bfloat16),
+              OV_CASE(Precision::I32, int32_t))
+
+    // the counters for the next run
+    const uint64_t skipCount = elemCount * skipConst;
+    state.first += skipCount;
+    if (state.first < skipCount)
+        state.second++;
+}
+
+bool RandomUniform::created() const {
+    return getType() == Type::RandomUniform;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
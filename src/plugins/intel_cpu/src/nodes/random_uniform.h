@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+
+#include <string>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class RandomUniform : public Node {
+public:
+    RandomUniform(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
+    bool needPrepareParams() const override { return false; }
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    struct RandomUniformContext {
+        RandomUniform* nodePtr;
+        uint64_t key;
+        uint64_t counter;
+        uint64_t n;
+        size_t elemCount;
+    };
+
+    template<typename T>
+    struct RandomUniformExecute {
+        void operator()(RandomUniformContext& ctx) {
+            ctx.nodePtr->generate<T>(ctx.key, ctx.counter, ctx.n, ctx.elemCount);
+        }
+    };
+
+    template <typename T>
+    void generate(uint64_t key, uint64_t counter, uint64_t n, size_t elemCount);
+
+    static constexpr size_t OUT_SHAPE = 0;
+    static constexpr size_t MIN_VAL = 1;
+    static constexpr size_t MAX_VAL = 2;
+
+    uint64_t globalSeed = 0;
+    uint64_t opSeed = 0;
+    // Philox counters state for the next run: {n, counter}, the same as the state of the reference implementation
+    std::pair<uint64_t, uint64_t> state = {0, 0};
+    InferenceEngine::Precision outputPrecision;
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -9,7 +9,10 @@
 #include <vector>
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <sstream>
 #include <tuple>
+#include <unordered_map>
 
 #include <dnnl_debug.h>
 #include <onednn/dnnl.h>
@@ -21,6 +24,7 @@
 #include <ie_ngraph_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/cpu_generator.hpp"
 #include "utils/cpu_utils.hpp"
 #include "snippets_transformations/fuse_load_store_and_convert.hpp"
@@ -35,7 +39,155 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
 
+// Writes the values of the op attributes, the attributes which values can't be written make the description incomplete
+class AttributesWriter : public ov::AttributeVisitor {
+public:
+    explicit AttributesWriter(std::ostream& os) : os(os) {}
+
+    bool isComplete() const {
+        return complete;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (const auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            write(name, a->get().to_string());
+        } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            std::ostringstream dimension;
+            dimension << a->get();
+            write(name, dimension.str());
+        } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            std::vector<std::string> types;
+            for (const auto& type : a->get())
+                types.push_back(type.get_type_name());
+            write(name, types);
+        } else {
+            complete = false;
+        }
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<void*>& adapter) override {
+        os << name << "=" << adapter.size() << ":";
+        os.write(static_cast<const char*>(adapter.get_ptr()), adapter.size());
+        os << ";";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        complete = false;
+    }
+
+private:
+    // the strings are prefixed with the size and the numbers are promoted, so the values can't be mixed up
+    void writeValue(const std::string& value) { os << value.size() << ":" << value; }
+    template <typename T>
+    void writeValue(const T& value) { os << +value; }
+    template <typename T>
+    void writeValue(const std::vector<T>& values) {
+        os << values.size() << "[";
+        for (const auto& value : values) {
+            writeValue(value);
+            os << ",";
+        }
+        os << "]";
+    }
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        os << name << "=";
+        writeValue(value);
+        os << ";";
+    }
+
+    std::ostream& os;
+    bool complete = true;
+};
+
+// Describes the body by its ops, their attributes and connections, the element types and shapes, but not the names,
+// so the identical subgraphs have the same description. Returns an empty string if some attribute can't be described.
+std::string describeBody(const ov::Model& body) {
+    std::ostringstream os;
+    os.precision(std::numeric_limits<double>::max_digits10);
+    AttributesWriter attributesWriter(os);
+    std::unordered_map<const ov::Node*, size_t> ids;
+    for (const auto& op : body.get_ordered_ops()) {
+        const size_t id = ids.size();
+        ids[op.get()] = id;
+        const auto& typeInfo = op->get_type_info();
+        os << typeInfo.name << "/" << (typeInfo.version_id ? typeInfo.version_id : "") << "(";
+        for (const auto& input : op->input_values())
+            os << ids.at(input.get_node()) << "." << input.get_index() << ",";
+        os << ")->(";
+        for (const auto& output : op->outputs())
+            os << output.get_element_type() << output.get_partial_shape() << ",";
+        os << "){";
+        op->visit_attributes(attributesWriter);
+        os << "}";
+    }
+    // the order of the parameters and results matches the ports of the node
+    for (const auto& parameter : body.get_parameters())
+        os << "P" << ids.at(parameter.get());
+    for (const auto& result : body.get_results())
+        os << "R" << ids.at(result.get());
+    return attributesWriter.isComplete() ? os.str() : std::string{};
+}
+
+struct SnippetKey {
+    // the original op identifies the body if it can't be described, it is held to keep the identity valid while
+    // the record is cached
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original;
+    std::string body;
+    cpu_isa_t isa;
+    VectorDims masterShape;
+    size_t tileRank;
+    std::vector<VectorDims> shapes;
+    std::vector<VectorDims> orders;
+    std::vector<Precision> precisions;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = body.empty() ? hash_combine(seed, original.get()) : hash_combine(seed, body);
+        seed = hash_combine(seed, static_cast<int>(isa));
+        seed = get_vector_hash(seed, masterShape);
+        seed = hash_combine(seed, tileRank);
+        for (const auto& shape : shapes)
+            seed = get_vector_hash(seed, shape);
+        for (const auto& order : orders)
+            seed = get_vector_hash(seed, order);
+        for (const auto& precision : precisions)
+            seed = hash_combine(seed, precision.getPrecVal());
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return body == rhs.body && (!body.empty() || original == rhs.original) && isa == rhs.isa && masterShape == rhs.masterShape &&
+               tileRank == rhs.tileRank && shapes == rhs.shapes && orders == rhs.orders && precisions == rhs.precisions;
+    }
+};
+
+} // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
         : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
@@ -343,8 +495,37 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+
+    // the generated code depends on the normalized shapes, the layouts and the precisions of the ports
+    SnippetKey key;
+    key.original = original_snippet;
+    key.body = describeBody(*original_snippet->body_ptr());
+    key.isa = host_isa;
+    key.masterShape = masterShape;
+    key.tileRank = tileRank;
+    key.shapes = normInputShapes;
+    key.shapes.insert(key.shapes.end(), normOutputShapes.begin(), normOutputShapes.end());
+    for (const auto& portConfigs : {config.inConfs, config.outConfs}) {
+        for (const auto& portConfig : portConfigs) {
+            const auto blockedDesc = portConfig.getMemDesc()->as<BlockedMemoryDesc>();
+            key.orders.push_back(blockedDesc->getOrder());
+            key.precisions.push_back(blockedDesc->getPrecision());
+        }
+    }
+
+    auto builder = [this, &jcp](const SnippetKey&) -> std::shared_ptr<CompiledSnippet> {
+        generate(&jcp);
+        auto compiled = std::make_shared<CompiledSnippet>();
+        compiled->snippet = snippet;
+        compiled->schedule = schedule;
+        compiled->bufferScratchpadSize = snippet->get_buffer_scratchpad_size();
+        return compiled;
+    };
+    auto cache = context->getParamsCache();
+    auto result = cache->getOrCreate(key, builder);
+    compiledSnippet = result.first;
+    schedule = compiledSnippet->schedule;
+    buffer_scratchpad_size = compiledSnippet->bufferScratchpadSize;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
@@ -40,6 +40,8 @@ public:
     void createPrimitive() override;
     void prepareParams() override;
     std::vector<VectorDims> shapeInfer() const override;
+    // shapeInfer() updates the master shape used by prepareParams(), so it can't be skipped
+    bool isShapeInferReplayable() const override { return false; }
     bool needPrepareParams() const override;
 
     bool canBeInPlace() const override;
@@ -73,6 +75,16 @@ private:
     // Local copy of subgraph node for canonization & code generation
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
+    // Generated code is shared between the nodes compiled for the same snippet body, shapes and layouts
+    // (e.g. the copies of the graph in the different streams) via the runtime cache
+    struct CompiledSnippet {
+        // the snippet copy owns the generated code
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+        size_t bufferScratchpadSize = 0;
+    };
+    std::shared_ptr<CompiledSnippet> compiledSnippet;
+
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
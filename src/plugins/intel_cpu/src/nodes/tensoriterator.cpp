@@ -13,6 +13,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
+#include "concat.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace dnnl;
@@ -78,6 +79,81 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// The body input memory may point to an external buffer if the body doesn't modify it, the rules are the same
+// as for the zero-copy inputs of the infer request
+static bool canAliasBodyInput(const NodePtr& input) {
+    for (auto& childEdge : input->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << input->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+        if (child->isConstant() || child->isInPlace() || child->getType() == Type::Split)
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        if (!ce->getMemoryPtr()->isUsedExternalStorage())
+            return false;
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The body output memory may point to an external buffer if it isn't shared with other body tensors
+static bool canAliasBodyOutput(const NodePtr& output) {
+    auto parentEdge = output->getParentEdgeAt(0);
+    auto parent = parentEdge->getParent();
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+        parent->getType() == Type::Input)
+        return false;
+
+    for (auto& edge : parent->getParentEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+        if (e->getMemory().GetData() == parentEdge->getMemory().GetData())
+            return false;
+    }
+    return parentEdge->getMemoryPtr()->isUsedExternalStorage();
+}
+
+static void setDataHandle(const std::vector<MemoryPtr>& mems, void* data) {
+    for (auto& mem : mems)
+        mem->setDataHandle(data);
+}
+
+// The chunk of the plain tensor is a contiguous block if all the dimensions before the axis are 1
+static bool isContiguousChunk(const MemoryPtr& full, const MemoryPtr& part, const int axis) {
+    const auto& full_desc = full->getDesc();
+    const auto& part_desc = part->getDesc();
+    if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+        full_desc.getPrecision() != part_desc.getPrecision())
+        return false;
+
+    const auto& full_dims = full->getStaticDims();
+    const auto& part_dims = part->getStaticDims();
+    if (std::accumulate(full_dims.begin(), full_dims.begin() + axis, size_t(1), std::multiplies<size_t>()) != 1)
+        return false;
+
+    const auto part_size = std::accumulate(part_dims.begin(), part_dims.end(), part_desc.getPrecision().size(),
+                                           std::multiplies<size_t>());
+    return part->GetSize() == part_size;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -145,6 +221,93 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy version of the PortIteratorHelper. Points the body memory to the chunk of the outer tensor,
+ * so the body reads its input from or writes its output to the outer tensor directly.
+ */
+class PortIteratorAliasHelper : public PortMapHelper {
+public:
+    PortIteratorAliasHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &part, const PortMap &slice_rule)
+                            : full_mem(full), part_mems(part) {
+        const auto axis = slice_rule.axis;
+        const auto stride = slice_rule.stride;
+        const auto abs_stride = std::abs(stride);
+
+        const auto& full_dims = full->getStaticDims();
+        iter_count = full_dims[axis] / abs_stride;
+
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(part.front()->GetSize());
+        chunk_offset_in_byte = stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= stride < 0 ? -1 : 1;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        setDataHandle(part_mems, static_cast<uint8_t *>(full_mem->GetData()) +
+                                 chunk_offset_in_byte + chunk_stride_in_byte * iter);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Zero-copy version of the BackEdgePortHelper. The body input of the next iteration points to the buffer
+ * written by the body output, the body output takes the released input buffer unless it points to the chunks
+ * of the outer tensor. Before the loop the body input returns to its own buffer to receive the initial value.
+ */
+class BackEdgeAliasHelper : public PortMapHelper {
+public:
+    BackEdgeAliasHelper(const MemoryPtr &from, const std::vector<MemoryPtr> &to,
+                        void* from_buffer, void* to_buffer, bool from_is_sliced)
+                        : from_mem(from), to_mems(to), from_buffer(from_buffer), to_buffer(to_buffer),
+                          from_is_sliced(from_is_sliced) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter < 0) {
+            setDataHandle(to_mems, to_buffer);
+            if (!from_is_sliced)
+                from_mem->setDataHandle(from_buffer);
+        } else if (iter > 0) {
+            void* produced = from_mem->GetData();
+            void* consumed = to_mems.front()->GetData();
+            setDataHandle(to_mems, produced);
+            if (!from_is_sliced)
+                from_mem->setDataHandle(consumed);
+        }
+    }
+
+private:
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+    void* from_buffer;
+    void* to_buffer;
+    bool from_is_sliced;
+};
+
+/**
+ * Zero-copy mapping of the invariant input, the body reads the outer tensor directly.
+ */
+class InvariantAliasHelper : public PortMapHelper {
+public:
+    InvariantAliasHelper(const MemoryPtr &from, const std::vector<MemoryPtr> &to) : from_mem(from), to_mems(to) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        setDataHandle(to_mems, from_mem->GetData());
+    }
+
+private:
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -229,89 +392,103 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
+void DynamicBuffer::reset(int exact_iter_count) {
+    num_execs = 0;
+    expected_iter_count = exact_iter_count;
+}
+
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
     if (iter == 0) {
         init(eng);
-        return;
+    } else {
+        const auto abs_stride = std::abs(map_rule.stride);
+        if (from->getStaticDims()[map_rule.axis] != static_cast<size_t>(abs_stride))
+            IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+            " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+        // the number of iterations is unknown, so the buffer grows geometrically to amortize the copies
+        if (num_execs == capacity) {
+            const auto new_capacity = capacity * 2;
+            move_buffer(create_buffer(eng, new_capacity), new_capacity);
+        }
     }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
     move_data();
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
     const auto axis = map_rule.axis;
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
+    const auto& dims = from->getStaticDims();
 
-    if (dims[axis] != abs_stride)
+    if (dims[axis] != static_cast<size_t>(abs_stride))
         IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
                    " is expected, but actual: " << dims[axis];
 
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
+    chunk_size_in_byte = abs_stride * len;
+    num_execs = 0;
 
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
+    // the buffer is pre-sized when the number of iterations is known,
+    // the buffer of the previous execution is reused if it has the same chunk shape and it's large enough
+    const size_t required_capacity = expected_iter_count > 0 ? static_cast<size_t>(expected_iter_count) : 1lu;
+    if (mem_holder_buffer && chunk_dims == dims && capacity >= required_capacity)
+        return;
 
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
+    chunk_dims = dims;
+    mem_holder_buffer = create_buffer(eng, required_capacity);
+    capacity = required_capacity;
+}
 
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng, const size_t new_capacity) {
+    auto dims = chunk_dims;
+    dims[map_rule.axis] *= new_capacity;
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
+    const auto buffer_dims = DnnlExtensionUtils::convertToDnnlDims(dims);
+    dnnl::memory::desc new_buffer_desc(buffer_dims, from->GetDataType(), DnnlExtensionUtils::GetPlainFormatByRank(buffer_dims.size()));
 
     return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+// The chunks are stored in the order of the concatenation: from the beginning of the buffer for the positive stride,
+// from the end of the buffer for the negative one
+size_t DynamicBuffer::first_chunk_offset(const size_t buffer_capacity) const {
+    return map_rule.stride > 0 ? 0lu : (buffer_capacity - num_execs) * chunk_size_in_byte;
+}
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer, const size_t new_capacity) {
+    const auto src_stride = capacity * chunk_size_in_byte;
+    const auto dst_stride = new_capacity * chunk_size_in_byte;
+
+    copy(get_ptr(*mem_holder_buffer.get()) + first_chunk_offset(capacity), get_ptr(*new_buffer.get()) + first_chunk_offset(new_capacity),
+         src_stride, dst_stride, count, num_execs * chunk_size_in_byte);
     mem_holder_buffer = new_buffer;
+    capacity = new_capacity;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    const auto dst_stride = capacity * chunk_size_in_byte;
+    const auto chunk_offset_in_byte = map_rule.stride > 0 ? num_execs * chunk_size_in_byte
+                                                          : (capacity - num_execs - 1) * chunk_size_in_byte;
 
     copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+         chunk_size_in_byte, dst_stride, count, chunk_size_in_byte);
+    num_execs++;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+    if (num_execs > 0) {
+        auto dims = chunk_dims;
+        dims[map_rule.axis] *= num_execs;
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto dst_stride = num_execs * chunk_size_in_byte;
+        copy(get_ptr(*mem_holder_buffer.get()) + first_chunk_offset(capacity), reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             capacity * chunk_size_in_byte, dst_stride, count, dst_stride);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -320,7 +497,7 @@ void DynamicBuffer::transfer(const Node* node) {
         redefineToMemories(to, desc);
     }
 
-    mem_holder_buffer.reset();
+    num_execs = 0;
 }
 
 void DynamicBuffer::copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len) {
@@ -371,6 +548,10 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            if (!isDynamicNode()) {
+                input_aliasable.push_back(canAliasBodyInput(inNode->second));
+                input_buffers.push_back(input_mems.back().front()->GetData());
+            }
         }
     }
 
@@ -382,6 +563,10 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            if (!isDynamicNode()) {
+                output_aliasable.push_back(canAliasBodyOutput(outNode->second));
+                output_buffers.push_back(outMem->GetData());
+            }
         }
     }
 
@@ -504,6 +689,8 @@ void TensorIterator::prepareParams() {
     first_mappers.clear();
     before_mappers.clear();
     back_mappers.clear();
+    after_mappers.clear();
+    last_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
@@ -513,8 +700,10 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // back edges have to read the body outputs of the previous iteration before the outputs are redirected
+            // to the chunks of the current iteration
             prepareBackEdges();
+            prepareOutputPorts();
         }
     }
 }
@@ -558,6 +747,11 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
+    // the number of iterations is exact if the body doesn't have the condition output
+    const int exact_num_iter = continue_cond && loopBodyConditionOutputIdx == -1 ? max_num_iter : -1;
+    for (auto& buffer : buffers)
+        buffer->reset(exact_num_iter);
+
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
@@ -583,17 +777,45 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
 
 /* *==============* Prepare reorders, edges between body and TI *==============* */
 
+bool TensorIterator::isBackEdgeInput(const int body_input_idx) const {
+    return std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) {
+        return rule.to == body_input_idx;
+    });
+}
+
+bool TensorIterator::canAliasSlicedOutput(const PortMap& map_rule) const {
+    if (isDynamicNode() || !output_aliasable[map_rule.to])
+        return false;
+    // the output has to be redirected once per iteration
+    const auto slices = std::count_if(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+        return rule.to == map_rule.to && rule.axis != -1;
+    });
+    const auto& to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+    return slices == 1 && isContiguousChunk(to_mem, output_mem[map_rule.to], map_rule.axis);
+}
+
 void TensorIterator::prepareInputPorts() {
     const auto &eng = getEngine();
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
+        auto &to_mems = input_mems[map_rule.to];
+        auto &to_mem = to_mems.front();  // first memory is enough to access the shared underlying physical memory
+        const bool aliasable = !isDynamicNode() && input_aliasable[map_rule.to];
 
-        if (map_rule.axis == -1)
-            first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(
-                    std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
+        if (map_rule.axis == -1) {
+            // the input updated by the back edge can't point to the outer tensor, the body would overwrite it
+            if (aliasable && !isBackEdgeInput(map_rule.to) && isContiguousChunk(from_mem, to_mem, 0) &&
+                from_mem->GetSize() == to_mem->GetSize())
+                first_mappers.emplace_back(std::make_shared<InvariantAliasHelper>(from_mem, to_mems));
+            else
+                first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        } else {
+            if (aliasable && isContiguousChunk(from_mem, to_mem, map_rule.axis))
+                before_mappers.emplace_back(std::make_shared<PortIteratorAliasHelper>(from_mem, to_mems, map_rule));
+            else
+                before_mappers.emplace_back(
+                        std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
+        }
     }
 }
 
@@ -605,6 +827,9 @@ void TensorIterator::prepareOutputPorts() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (canAliasSlicedOutput(map_rule))
+            // the body writes the chunk directly, so the mapper is applied before each iteration
+            before_mappers.emplace_back(std::make_shared<PortIteratorAliasHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
     }
@@ -614,9 +839,28 @@ void TensorIterator::prepareBackEdges() {
     const auto &eng = getEngine();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mems[map_rule.to].front();
-
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        auto &to_mems = input_mems[map_rule.to];
+        auto to_mem = to_mems.front();
+
+        const auto from_users = std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) {
+            return rule.from == map_rule.from;
+        });
+        // the output written directly to the chunks of the outer tensor doesn't take the input buffer
+        const bool from_is_sliced = std::any_of(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+            return rule.to == map_rule.from && rule.axis != -1 && canAliasSlicedOutput(rule);
+        });
+        // otherwise the body output and input swap their buffers, so they have to be interchangeable
+        if (input_aliasable[map_rule.to] && output_aliasable[map_rule.from] && from_users == 1 &&
+            from_mem->getDesc().isCompatible(to_mem->getDesc())) {
+            auto mapper = std::make_shared<BackEdgeAliasHelper>(from_mem, to_mems,
+                                                                output_buffers[map_rule.from], input_buffers[map_rule.to],
+                                                                from_is_sliced);
+            // the own buffers are restored before the initial values are copied
+            first_mappers.insert(first_mappers.begin(), mapper);
+            before_mappers.emplace_back(mapper);
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        }
     }
 }
 
@@ -67,6 +67,8 @@ public:
     DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
+    /* exact_iter_count is the number of iterations if it's known before the loop execution, otherwise -1 */
+    void reset(int exact_iter_count);
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
 
@@ -74,9 +76,10 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
+    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng, const size_t new_capacity);
+    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer, const size_t new_capacity);
     void move_data();
+    size_t first_chunk_offset(const size_t buffer_capacity) const;
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
@@ -84,8 +87,11 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;
+    size_t num_execs = 0lu;   /**< Number of chunks stored in the buffer */
+    size_t capacity = 0lu;    /**< Number of chunks the buffer can store without reallocation */
+    int expected_iter_count = -1;
+    VectorDims chunk_dims;
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
@@ -126,6 +132,10 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Zero-copy port mapping */
+    bool isBackEdgeInput(const int body_input_idx) const;
+    bool canAliasSlicedOutput(const PortMap& map_rule) const;
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -137,6 +147,13 @@ private:
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
 
+    /* Body inputs and outputs which memory can point to the outer tensors or to each other instead of copying,
+     * with their own buffers to return to. Defined only for the static node */
+    std::vector<bool> input_aliasable;
+    std::vector<bool> output_aliasable;
+    std::vector<void*> input_buffers;
+    std::vector<void*> output_buffers;
+
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
         last_mappers,    /// < Applied once after loop
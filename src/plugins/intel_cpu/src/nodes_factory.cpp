@@ -85,6 +85,7 @@
 #include "nodes/ctc_greedy_decoder.h"
 #include "nodes/non_zero.h"
 #include "nodes/color_convert.h"
+#include "nodes/fused_preprocess.h"
 #include "nodes/subgraph.h"
 #include "nodes/priorbox.h"
 #include "nodes/priorbox_clustered.h"
@@ -92,6 +93,7 @@
 #include "nodes/interaction.h"
 #include "nodes/mha.h"
 #include "nodes/unique.hpp"
+#include "nodes/random_uniform.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -190,12 +192,14 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(NonZero, Type::NonZero);
     INTEL_CPU_NODE(Snippet, Type::Subgraph);
     INTEL_CPU_NODE(ColorConvert, Type::ColorConvert);
+    INTEL_CPU_NODE(FusedPreprocess, Type::FusedPreprocess);
     INTEL_CPU_NODE(PriorBox, Type::PriorBox);
     INTEL_CPU_NODE(PriorBoxClustered, Type::PriorBoxClustered);
     INTEL_CPU_NODE(Eye, Type::Eye);
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(MHA, Type::MHA);
     INTEL_CPU_NODE(Unique, Type::Unique);
+    INTEL_CPU_NODE(RandomUniform, Type::RandomUniform);
 }
 
 #undef INTEL_CPU_NODE
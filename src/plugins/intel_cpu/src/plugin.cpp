@@ -17,6 +17,7 @@
 #include "ie_plugin_config.hpp"
 #include "ie_system_conf.h"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <ie_ngraph_utils.hpp>
 
@@ -353,6 +354,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
     CREATE_DEBUG_TIMER(debugLoadTimer);
+    ov::CompilationProfile::Stage profileStage("plugin_compile", network.getName());
 
     // verification of supported input
     for (const auto &ii : network.getInputsInfo()) {
@@ -515,6 +517,10 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::inter_op_parallel) {
+        return decltype(ov::intel_cpu::inter_op_parallel)::value_type(engConfig.interOpParallel);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(engConfig.hugePages);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -597,6 +603,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::inter_op_parallel.name()),
+                                                    RW_property(ov::intel_cpu::huge_pages.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -712,6 +720,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    auto compiledGraphData = std::make_shared<CompiledGraphData>();
+    deserializer >> *compiledGraphData;
 
     Config conf = engConfig;
     conf.readProperties(config);
@@ -736,7 +746,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(),
+                                                     compiledGraphData->empty() ? nullptr : compiledGraphData);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -5,6 +5,11 @@
 
 #include <openvino/pass/serialize.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+
 #include <pugixml.hpp>
 
 using namespace InferenceEngine;
@@ -59,6 +64,78 @@ namespace {
             info_iter->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // Marks the beginning of the compiled graph data section which follows the serialized network
+    constexpr uint64_t compiledGraphDataMagic = 0x4850415247555043ull;  // "CPUGRAPH"
+
+    template <typename T>
+    void write(std::ostream & stream, const T & value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void write(std::ostream & stream, const std::string & str) {
+        write(stream, static_cast<uint64_t>(str.size()));
+        stream.write(str.data(), str.size());
+    }
+
+    template <typename T>
+    T read(std::istream & stream) {
+        T value = {};
+        stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+        if (!stream.good()) {
+            IE_THROW(NetworkNotRead) << "The compiled graph data is corrupted.";
+        }
+        return value;
+    }
+
+    // Byte ranges of the weights section (relative to its beginning) which are not written to the stream
+    using ConstantGaps = std::vector<std::pair<uint64_t, uint64_t>>;  // offset, size
+
+    // The data of the elided constants is excluded unless it is shared with a stored constant
+    // (the serializer writes the identical constants once)
+    ConstantGaps getConstantGaps(const pugi::xml_document & xml, const std::unordered_set<std::string> & elided) {
+        ConstantGaps elidedRanges, keptRanges;
+        for (const auto & layer : xml.child("net").child("layers").children("layer")) {
+            if (std::string(layer.attribute("type").value()) != "Const")
+                continue;
+            const auto data = layer.child("data");
+            const auto range = std::make_pair(data.attribute("offset").as_ullong(), data.attribute("size").as_ullong());
+            if (elided.count(layer.attribute("name").value())) {
+                elidedRanges.push_back(range);
+            } else {
+                keptRanges.push_back(range);
+            }
+        }
+
+        const auto overlaps = [](const std::pair<uint64_t, uint64_t> & a, const std::pair<uint64_t, uint64_t> & b) {
+            return a.first < b.first + b.second && b.first < a.first + a.second;
+        };
+        ConstantGaps gaps;
+        std::sort(elidedRanges.begin(), elidedRanges.end());
+        for (const auto & range : elidedRanges) {
+            if (range.second == 0 ||
+                std::any_of(keptRanges.begin(), keptRanges.end(), [&](const std::pair<uint64_t, uint64_t> & kept) {
+                    return overlaps(range, kept);
+                }))
+                continue;
+            if (!gaps.empty() && gaps.back().first + gaps.back().second >= range.first) {
+                gaps.back().second = std::max(gaps.back().first + gaps.back().second, range.first + range.second) -
+                                     gaps.back().first;
+            } else {
+                gaps.push_back(range);
+            }
+        }
+        return gaps;
+    }
+
+    std::string readString(std::istream & stream) {
+        std::string str(read<uint64_t>(stream), '\0');
+        stream.read(&str[0], str.size());
+        if (!stream.good()) {
+            IE_THROW(NetworkNotRead) << "The compiled graph data is corrupted.";
+        }
+        return str;
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -113,10 +190,83 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     };
 
     // Serialize to old representation in case of old API
-    OPENVINO_SUPPRESS_DEPRECATED_START
-    ov::pass::StreamSerialize serializer(_ostream, getCustomOpSets(), serializeInputsAndOutputs);
-    OPENVINO_SUPPRESS_DEPRECATED_END
-    serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+    auto serialize = [&](std::ostream & stream) {
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        ov::pass::StreamSerialize serializer(stream, getCustomOpSets(), serializeInputsAndOutputs);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+    };
+
+    if (!_compiledData) {
+        serialize(_ostream);
+        return;
+    }
+
+    // The network is serialized into a buffer, so the data of the elided constants can be cut out of the weights
+    // section. The positions of the gaps are stored in the compiled graph data, the gaps are filled with zeros on import.
+    std::stringstream buffer;
+    serialize(buffer);
+    const std::string blob = buffer.str();
+    ov::pass::StreamSerialize::DataHeader hdr = {};
+    std::memcpy(&hdr, blob.data(), sizeof hdr);
+
+    pugi::xml_document xml;
+    if (xml.load_buffer(blob.data() + hdr.model_offset, hdr.model_size).status != pugi::status_ok) {
+        IE_THROW() << "Failed to parse the serialized network.";
+    }
+    const auto gaps = getConstantGaps(xml, _compiledData->elidedConstants);
+
+    uint64_t gapsSize = 0;
+    for (const auto & gap : gaps)
+        gapsSize += gap.second;
+
+    const size_t headerOffset = _ostream.tellp();
+    auto outHdr = hdr;
+    outHdr.custom_data_offset = headerOffset + sizeof outHdr;
+    outHdr.consts_offset = outHdr.custom_data_offset + hdr.custom_data_size;
+    outHdr.consts_size = hdr.consts_size - gapsSize;
+    outHdr.model_offset = outHdr.consts_offset + outHdr.consts_size;
+    write(_ostream, outHdr);
+    _ostream.write(blob.data() + hdr.custom_data_offset, hdr.custom_data_size);
+    uint64_t constsPos = 0;
+    for (const auto & gap : gaps) {
+        _ostream.write(blob.data() + hdr.consts_offset + constsPos, gap.first - constsPos);
+        constsPos = gap.first + gap.second;
+    }
+    _ostream.write(blob.data() + hdr.consts_offset + constsPos, hdr.consts_size - constsPos);
+    _ostream.write(blob.data() + hdr.model_offset, hdr.model_size);
+
+    const auto & compiledData = *_compiledData;
+    write(_ostream, compiledGraphDataMagic);
+
+    write(_ostream, static_cast<uint64_t>(compiledData.implTypes.size()));
+    for (const auto & implType : compiledData.implTypes) {
+        write(_ostream, implType.first);
+        write(_ostream, std::string(impl_type_to_string(implType.second)));
+    }
+
+    write(_ostream, static_cast<uint64_t>(compiledData.constants.size()));
+    for (const auto & constant : compiledData.constants) {
+        write(_ostream, constant.first);
+        write(_ostream, constant.second.descSignature);
+        write(_ostream, static_cast<uint64_t>(constant.second.data.size()));
+        _ostream.write(reinterpret_cast<const char*>(constant.second.data.data()), constant.second.data.size());
+    }
+
+    write(_ostream, static_cast<uint64_t>(compiledData.elidedConstants.size()));
+    for (const auto & name : compiledData.elidedConstants) {
+        write(_ostream, name);
+    }
+
+    write(_ostream, static_cast<uint64_t>(gaps.size()));
+    for (const auto & gap : gaps) {
+        write(_ostream, gap.first);
+        write(_ostream, gap.second);
+    }
+}
+
+void CNNNetworkSerializer::operator << (const CompiledGraphData & compiledData) {
+    _compiledData = &compiledData;
 }
 
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
@@ -143,13 +293,31 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
         IE_THROW(NetworkNotRead) << "The inputs and outputs information is invalid.";
     }
 
+    // the compiled graph data follows the network, it describes the gaps in the weights section
+    ConstantGaps gaps;
+    readCompiledGraphData(hdr.model_offset + hdr.model_size, gaps);
+    uint64_t gapsSize = 0;
+    for (const auto & gap : gaps)
+        gapsSize += gap.second;
+
     // read blob content
     _istream.seekg(hdr.consts_offset);
-    if (hdr.consts_size) {
+    const size_t constsSize = hdr.consts_size + gapsSize;
+    if (constsSize) {
         dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {constsSize}, InferenceEngine::Layout::C));
         dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        auto data = dataBlob->buffer().as<char*>();
+        uint64_t constsPos = 0;
+        for (const auto & gap : gaps) {
+            if (gap.first < constsPos || gap.first + gap.second > constsSize) {
+                IE_THROW(NetworkNotRead) << "The compiled graph data is corrupted.";
+            }
+            _istream.read(data + constsPos, gap.first - constsPos);
+            std::memset(data + gap.first, 0, gap.second);
+            constsPos = gap.first + gap.second;
+        }
+        _istream.read(data + constsPos, constsSize - constsPos);
     }
 
     // read XML content
@@ -166,6 +334,56 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setInfo(inputs.children("in"), network.getInputsInfo());
     setInfo(outputs.children("out"), network.getOutputsInfo());
+    _networkRead = true;
+}
+
+void CNNNetworkDeserializer::readCompiledGraphData(std::streamoff offset, ConstantGaps & gaps) {
+    auto & compiledData = _compiledData;
+    compiledData = {};
+    _istream.seekg(offset);
+    // the models cached by the previous versions of the plugin don't contain the compiled graph data
+    uint64_t magic = 0;
+    _istream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    if (!_istream.good() || magic != compiledGraphDataMagic) {
+        _istream.clear();
+        return;
+    }
+
+    const auto implTypesNum = read<uint64_t>(_istream);
+    for (uint64_t i = 0; i < implTypesNum; i++) {
+        auto nodeName = readString(_istream);
+        compiledData.implTypes[nodeName] = parse_impl_name(readString(_istream));
+    }
+
+    const auto constantsNum = read<uint64_t>(_istream);
+    for (uint64_t i = 0; i < constantsNum; i++) {
+        auto edgeName = readString(_istream);
+        auto & constant = compiledData.constants[edgeName];
+        constant.descSignature = readString(_istream);
+        constant.data.resize(read<uint64_t>(_istream));
+        _istream.read(reinterpret_cast<char*>(constant.data.data()), constant.data.size());
+        if (!_istream.good()) {
+            IE_THROW(NetworkNotRead) << "The compiled graph data is corrupted.";
+        }
+    }
+
+    const auto elidedNum = read<uint64_t>(_istream);
+    for (uint64_t i = 0; i < elidedNum; i++) {
+        compiledData.elidedConstants.insert(readString(_istream));
+    }
+
+    const auto gapsNum = read<uint64_t>(_istream);
+    for (uint64_t i = 0; i < gapsNum; i++) {
+        const auto gapOffset = read<uint64_t>(_istream);
+        gaps.emplace_back(gapOffset, read<uint64_t>(_istream));
+    }
+}
+
+void CNNNetworkDeserializer::operator >> (CompiledGraphData & compiledData) {
+    if (!_networkRead) {
+        IE_THROW() << "The network must be deserialized before the compiled graph data.";
+    }
+    compiledData = std::move(_compiledData);
 }
 
 }   // namespace intel_cpu
@@ -3,9 +3,12 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "compiled_graph_data.h"
 
 #include <iostream>
 #include <functional>
+#include <utility>
+#include <vector>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
@@ -14,11 +17,15 @@ namespace intel_cpu {
 class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
+    // must be called before the network serialization, the data is written after the network,
+    // the data of the elided constants is not written
+    void operator << (const CompiledGraphData & compiledData);
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     ExtensionManager::Ptr _extensionManager;
+    const CompiledGraphData * _compiledData = nullptr;
 };
 
 class CNNNetworkDeserializer {
@@ -29,10 +36,17 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    // must be called after the network deserialization, returns empty data if the stream doesn't contain it
+    void operator >> (CompiledGraphData & compiledData);
 
 private:
+    // reads the compiled graph data and the gaps of the weights section left by the elided constants
+    void readCompiledGraphData(std::streamoff offset, std::vector<std::pair<uint64_t, uint64_t>> & gaps);
+
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    CompiledGraphData _compiledData;
+    bool _networkRead = false;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -90,6 +90,7 @@
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
 #include "ngraph_transformations/convert_to_interaction.hpp"
+#include "ngraph_transformations/fuse_preprocessing.hpp"
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
@@ -208,6 +209,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     static const auto precisions = get_convert_precisions();
     type_to_fuse_map type_to_fuse = {{ov::opset10::Convert::get_type_info_static(), fuse_type_to_convert}};
 
+    // must go before CommonOptimizations, which rewrites the preprocessing subgraph (Divide, Interpolate, Transpose)
+    manager.register_pass<FusePreprocessing>();
     manager.register_pass<ov::pass::AUGRUCellFusion>();
     manager.register_pass<ov::pass::CommonOptimizations>();
     manager.register_pass<ov::pass::WrapInterpolateIntoTransposes>();
@@ -226,7 +229,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     manager.register_pass<ov::pass::ConvertMulticlassNmsToMulticlassNmsIE>();
     manager.register_pass<ov::pass::ConvertMatrixNmsToMatrixNmsIE>();
     manager.register_pass<ov::pass::TransposeMatMul>();
-    manager.register_pass<ov::pass::ConstantFolding>();
+    // the weights subgraphs of the big models are folded in parallel
+    manager.register_pass<ov::pass::ConstantFolding>(static_cast<size_t>(parallel_get_max_threads()));
 
     if (useLpt) {
         CPU_LPT_SCOPE(LowPrecisionTransformations_Part2);
@@ -5,12 +5,33 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <openvino/util/xxhash.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
-const SimpleDataHash WeightsSharing::simpleCRC;
+constexpr size_t DataHash::kChunkSize;
+
+uint64_t DataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize) {
+        return ov::util::xxh64(data, size, 0);
+    }
+
+    // The chunks are hashed independently (the chunk index is used as a seed), then the chunk hashes are combined.
+    const size_t chunksNum = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = ov::util::xxh64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+    return ov::util::xxh64(chunkHashes.data(), chunksNum * sizeof(uint64_t), size);
+}
+
+const DataHash WeightsSharing::dataHash{};
 
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -23,28 +23,18 @@
 namespace ov {
 namespace intel_cpu {
 
-class SimpleDataHash {
+/**
+ * 64-bit hash of the constant data used to build the keys of the shared weights.
+ * The data is processed by the XXH64 algorithm which consumes 32 bytes per iteration in four independent lanes,
+ * so it runs close to the memory bandwidth. Large buffers are split into fixed size chunks hashed in parallel,
+ * the result doesn't depend on the number of threads.
+ */
+class DataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    // the buffers larger than this size are hashed in parallel by chunks of this size
+    static constexpr size_t kChunkSize = 1 << 20;
 };
 
 /**
@@ -94,12 +84,12 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const DataHash& GetHashFunc () { return dataHash; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    static const DataHash dataHash;
 };
 
 /**
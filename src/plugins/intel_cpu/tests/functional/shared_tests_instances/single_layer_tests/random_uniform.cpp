@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "single_layer_tests/random_uniform.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<RandomUniformTypeSpecificParams> randomUniformSpecificParams = {
+        {InferenceEngine::Precision::FP32, 0.0f, 1.0f},
+        {InferenceEngine::Precision::FP32, -50.0f, 50.0f},
+        {InferenceEngine::Precision::I32, -100, 50},
+        {InferenceEngine::Precision::I32, 0, 3},
+};
+
+const std::vector<int64_t> globalSeeds = {10, 150};
+const std::vector<int64_t> opSeeds = {10, 50};
+
+// the sizes which are not a multiple of the Philox output size and the ones split between the threads
+const std::vector<ov::Shape> outputShapes = {
+        {1, 3, 3},
+        {3, 5, 7},
+        {2, 100, 300},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BasicRandomUniform, RandomUniformLayerTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(outputShapes),
+                                 ::testing::ValuesIn(randomUniformSpecificParams),
+                                 ::testing::ValuesIn(globalSeeds),
+                                 ::testing::ValuesIn(opSeeds),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         RandomUniformLayerTest::getTestCaseName);
+
+}  // namespace
@@ -466,6 +466,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommon, LoopLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the body has the condition output, so the concatenation buffer grows several times during the loop
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommonLongTripCount, LoopLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(trip_count_type),
+                                 ::testing::Values(37),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs),
+                                 ::testing::Values(types),
+                                 ::testing::Values(ElementType::f32)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 std::vector<std::vector<InputShape>> inputs_2 = {
     {  //first test suit
         {   //dynamic shape
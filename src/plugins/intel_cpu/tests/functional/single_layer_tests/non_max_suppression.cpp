@@ -435,4 +435,28 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// a few (batch, class) pairs with many boxes, the suppression within a class is executed in parallel
+const std::vector<InputShapeParams> inShapeParamsManyBoxes = {
+    InputShapeParams{std::vector<ov::Dimension>{}, std::vector<TargetShapeParams>{TargetShapeParams{1, 1000, 1}}},
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{1, 1500, 2},
+                                                                                            TargetShapeParams{1, 300, 1}}}
+};
+
+const auto nmsParamsManyBoxes = ::testing::Combine(::testing::ValuesIn(inShapeParamsManyBoxes),
+                                                   ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                      ::testing::Values(ElementType::i32),
+                                                                      ::testing::Values(ElementType::f32)),
+                                                   ::testing::Values(200, 1000),
+                                                   ::testing::Combine(::testing::ValuesIn(threshold),
+                                                                      ::testing::Values(0.0f),
+                                                                      ::testing::Values(0.0f)),
+                                                   ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::ValuesIn(sortResDesc),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_ManyBoxes, NmsLayerCPUTest, nmsParamsManyBoxes, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
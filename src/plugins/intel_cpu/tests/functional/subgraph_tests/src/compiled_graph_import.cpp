@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset9.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <ie_system_conf.h>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <fstream>
+
+using namespace CPUTestUtils;
+using namespace ov::opset9;
+
+namespace SubgraphTestsDefinitions {
+
+// The exported CPU model contains the compilation results (the selected primitives and the reordered weights),
+// the model imported using them must be identical to the original one. The constant multiplier is reordered to
+// the blocked layout of the convolution output. The exported model keeps the original multiplier as well, only the
+// model cache stores just the reordered copy of it if requested.
+class CompiledGraphImportTest : public ::testing::TestWithParam<int>, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> makeModel(const std::vector<float>& multiplierData) {
+        const auto precision = ov::element::f32;
+        auto params = ngraph::builder::makeParams(precision, {{1, 16, 14, 14}});
+        auto conv1 = ngraph::builder::makeConvolution(params[0], precision, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                      {1, 1}, ov::op::PadType::EXPLICIT, 32);
+        auto relu = std::make_shared<Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0},
+                                                      {1, 1}, ov::op::PadType::EXPLICIT, 16);
+        auto multiplier = Constant::create(precision, {1, 16, 14, 14}, multiplierData);
+        auto multiply = std::make_shared<Multiply>(conv2, multiplier);
+        auto matMulWeights = ngraph::builder::makeConstant<float>(precision, {16 * 14 * 14, 10}, {}, true);
+        auto reshape = std::make_shared<Reshape>(multiply, Constant::create(ov::element::i64, {2}, {1, -1}), false);
+        auto matMul = std::make_shared<MatMul>(reshape, matMulWeights);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<Result>(matMul)}, params, "CompiledGraphImport");
+    }
+
+    static std::map<std::string, std::string> getPrimitiveTypes(const ov::CompiledModel& compiledModel) {
+        std::map<std::string, std::string> primitiveTypes;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            primitiveTypes[node->get_friendly_name()] = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+        }
+        return primitiveTypes;
+    }
+
+    static std::vector<float> makeMultiplierData() {
+        std::vector<float> multiplierData(16 * 14 * 14);
+        for (size_t i = 0; i < multiplierData.size(); i++) {
+            multiplierData[i] = static_cast<float>(i % 13) / 13.f + 0.5f;
+        }
+        return multiplierData;
+    }
+
+    static ov::Tensor makeInput() {
+        ov::Tensor input(ov::element::f32, ov::Shape{1, 16, 14, 14});
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++) {
+            inputData[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+        }
+        return input;
+    }
+
+    static std::string toBytes(const std::vector<float>& data) {
+        return std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    }
+
+    static std::vector<float> infer(ov::CompiledModel& compiledModel, const ov::Tensor& input) {
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+        auto output = inferRequest.get_output_tensor();
+        const auto outputData = output.data<float>();
+        return std::vector<float>(outputData, outputData + output.get_size());
+    }
+};
+
+TEST_P(CompiledGraphImportTest, CompareWithOriginal) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto multiplierData = makeMultiplierData();
+    ov::Core core;
+    ov::CompiledModel compiledModel = core.compile_model(makeModel(multiplierData), "CPU", ov::num_streams(GetParam()));
+    std::stringstream stream;
+    compiledModel.export_model(stream);
+    const std::string blob = stream.str();
+    ov::CompiledModel importedModel = core.import_model(stream, "CPU", {ov::num_streams(GetParam())});
+
+    const auto input = makeInput();
+    ASSERT_EQ(infer(compiledModel, input), infer(importedModel, input));
+    ASSERT_EQ(getPrimitiveTypes(compiledModel), getPrimitiveTypes(importedModel));
+
+    // the compiled model is not restored from anything
+    for (const auto& value : compiledModel.get_property(ov::intel_cpu::import_statistics)) {
+        ASSERT_EQ(value.second, 0u) << value.first;
+    }
+    auto stat = importedModel.get_property(ov::intel_cpu::import_statistics);
+    ASSERT_GT(stat["RESTORED_IMPL_TYPES"], 0u);
+
+    // the exported model is self-contained, the original weights are kept even if the reordered copy is stored
+    ASSERT_NE(blob.find(toBytes(multiplierData)), std::string::npos) << "The original weights are not stored in the model";
+
+    // the blocked layouts are used with AVX2 and newer, otherwise the multiplier is consumed as is
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        ASSERT_GT(stat["RESTORED_CONSTANTS"], 0u);
+        ASSERT_GT(stat["SKIPPED_CONSTANT_NODES"], 0u);
+    }
+}
+
+TEST_P(CompiledGraphImportTest, ElideWeightsInModelCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto multiplierData = makeMultiplierData();
+    const std::string cacheDir = CommonTestUtils::generateTestFilePrefix() + "_cache";
+    const ov::AnyMap config = {ov::num_streams(GetParam()), {"CPU_CACHE_ELIDE_WEIGHTS", "YES"}};
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+    ov::CompiledModel compiledModel = core.compile_model(makeModel(multiplierData), "CPU", config);
+    ov::CompiledModel importedModel = core.compile_model(makeModel(multiplierData), "CPU", config);
+
+    std::string blob;
+    const auto blobFiles = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(blobFiles.size(), 1u);
+    {
+        std::ifstream blobFile(blobFiles.front(), std::ios::binary);
+        blob.assign(std::istreambuf_iterator<char>(blobFile), std::istreambuf_iterator<char>());
+    }
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+
+    const auto input = makeInput();
+    ASSERT_EQ(infer(compiledModel, input), infer(importedModel, input));
+    auto stat = importedModel.get_property(ov::intel_cpu::import_statistics);
+    ASSERT_GT(stat["RESTORED_IMPL_TYPES"], 0u);
+
+    // the blocked layouts are used with AVX2 and newer, otherwise the multiplier is consumed as is and kept
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        ASSERT_GT(stat["RESTORED_CONSTANTS"], 0u);
+        ASSERT_EQ(blob.find(toBytes(multiplierData)), std::string::npos) << "The original weights are stored in the cache";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompiledGraphImport, CompiledGraphImportTest, ::testing::Values(1, 2),
+                         CompiledGraphImportTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
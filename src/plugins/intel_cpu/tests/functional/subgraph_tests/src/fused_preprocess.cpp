@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ov::preprocess;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   NV12/I420 planes (u8)
+ *            |
+ *   [Convert f32] -> NV12/I420 to RGB/BGR -> [Convert f32]
+ *            |
+ *   Interpolate (linear, half_pixel)
+ *            |
+ *   Subtract mean -> Divide scale
+ *            |
+ *   Transpose NHWC -> NCHW
+ *            |
+ *          Result
+ */
+// The preprocessing chain built by PrePostProcessor is collapsed into a single FusedPreprocess node, its output is
+// compared with the reference computed op by op. The color conversion is done either on u8 (the result is rounded)
+// or on f32, the image is downscaled or upscaled with different factors along the height and the width.
+
+using FusedPreprocessParams = std::tuple<ColorFormat,               // source color format
+                                         ColorFormat,               // RGB or BGR
+                                         bool,                      // color conversion on u8
+                                         std::pair<size_t, size_t>  // source height and width
+                                         >;
+
+class FusedPreprocessSubgraphTest : public testing::WithParamInterface<FusedPreprocessParams>,
+                                    virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FusedPreprocessParams>& obj) {
+        ColorFormat srcFormat, dstFormat;
+        bool u8ColorConversion;
+        std::pair<size_t, size_t> srcSize;
+        std::tie(srcFormat, dstFormat, u8ColorConversion, srcSize) = obj.param;
+
+        std::ostringstream result;
+        result << "srcFormat=" << static_cast<int>(srcFormat) << "_";
+        result << "dstFormat=" << (dstFormat == ColorFormat::BGR ? "BGR" : "RGB") << "_";
+        result << "u8ColorConversion=" << u8ColorConversion << "_";
+        result << "srcSize=" << srcSize.first << "x" << srcSize.second;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        ColorFormat srcFormat, dstFormat;
+        bool u8ColorConversion;
+        std::pair<size_t, size_t> srcSize;
+        std::tie(srcFormat, dstFormat, u8ColorConversion, srcSize) = this->GetParam();
+
+        // the rounding of the u8 color conversion may differ by one for the values close to .5,
+        // which is below the threshold after the scale
+        abs_threshold = 0.05f;
+
+        // the batch checks the strides of the planes
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3, 12, 14});
+        param->set_layout("NCHW");
+        auto result = std::make_shared<ov::op::v0::Result>(param);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "FusedPreprocess");
+
+        PrePostProcessor p(function);
+        p.input().tensor().set_element_type(ov::element::u8)
+                          .set_color_format(srcFormat)
+                          .set_spatial_static_shape(srcSize.first, srcSize.second);
+        auto& preprocess = p.input().preprocess();
+        if (!u8ColorConversion)
+            preprocess.convert_element_type(ov::element::f32);
+        preprocess.convert_color(dstFormat);
+        if (u8ColorConversion)
+            preprocess.convert_element_type(ov::element::f32);
+        preprocess.resize(ResizeAlgorithm::RESIZE_LINEAR)
+                  .mean({123.675f, 116.28f, 103.53f})
+                  .scale({58.395f, 57.12f, 57.375f});
+        p.input().model().set_layout("NCHW");
+        function = p.build();
+
+        std::vector<ov::Shape> shapes;
+        for (const auto& input : function->inputs()) {
+            shapes.push_back(input.get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(shapes));
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            // the whole u8 range, so the clipping of the color conversion is covered as well
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i],
+                                                                  255, 0, 1, static_cast<int>(i + 1));
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(FusedPreprocessSubgraphTest, CompareWithRefs) {
+    run();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "FusedPreprocess", 1);
+}
+
+namespace {
+
+const std::vector<ColorFormat> srcFormats = {
+    ColorFormat::NV12_SINGLE_PLANE,
+    ColorFormat::NV12_TWO_PLANES,
+    ColorFormat::I420_SINGLE_PLANE,
+    ColorFormat::I420_THREE_PLANES
+};
+
+const std::vector<std::pair<size_t, size_t>> srcSizes = {
+    {30, 20},   // downscale
+    {8, 10}     // upscale
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FusedPreprocess, FusedPreprocessSubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(srcFormats),
+                                            ::testing::Values(ColorFormat::RGB, ColorFormat::BGR),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(srcSizes)),
+                         FusedPreprocessSubgraphTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
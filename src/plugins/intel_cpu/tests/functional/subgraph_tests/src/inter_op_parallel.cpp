@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include <ie_parallel.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                       Parameter
+ *            /         /         \           \
+ *     Conv 3x3     Conv 1x1     MaxPool     Conv 1x1
+ *        |                        |            |
+ *      Relu                    Conv 1x1     Conv 3x3
+ *            \         \         /           /
+ *                        Concat
+ *                          |
+ *                        Result
+ */
+
+class InterOpParallelSubgraphTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::inter_op_parallel(true));
+        configuration.insert(ov::enable_profiling(true));
+
+        const auto precision = ov::element::f32;
+        const ov::Shape inputShape{1, 16, 28, 28};
+        init_input_shapes({InputShape{{}, {inputShape}}});
+
+        auto params = ngraph::builder::makeParams(precision, {inputShape});
+        auto makeConv = [&](const ov::Output<ov::Node>& in, size_t kernel, size_t outChannels) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return ngraph::builder::makeConvolution(in, precision, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad},
+                                                    {1, 1}, ov::op::PadType::EXPLICIT, outChannels);
+        };
+
+        auto branch0 = ngraph::builder::makeActivation(makeConv(params[0], 3, 8), precision, ngraph::helpers::ActivationTypes::Relu);
+        auto branch1 = makeConv(params[0], 1, 8);
+        auto pool = ngraph::builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ov::op::RoundingType::FLOOR,
+                                                 ov::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto branch2 = makeConv(pool, 1, 8);
+        auto branch3 = makeConv(makeConv(params[0], 1, 8), 3, 8);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch0, branch1, branch2, branch3}, 1);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat)};
+        function = std::make_shared<ov::Model>(results, params, "InterOpParallel");
+    }
+
+    void checkBranchesPerfCounters() {
+        size_t branchesCount = 0;
+        for (const auto& info : inferRequest.get_profiling_info()) {
+            if (info.node_type == "InterOpBranch") {
+                branchesCount++;
+            }
+        }
+        // the level with four convolutions must be executed in several branches
+        ASSERT_GT(branchesCount, 1);
+    }
+};
+
+TEST_F(InterOpParallelSubgraphTest, smoke_InterOpParallel_CPU) {
+    run();
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::inter_op_parallel));
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the branches are executed concurrently only with TBB threading and more than one thread in the stream
+    if (parallel_get_max_threads() > 1) {
+        checkBranchesPerfCounters();
+    }
+#endif
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Constant
+ *         |
+ *     ReadValue   beam_idx
+ *          \       /
+ *           Gather      position   new_kv
+ *               \          |        /
+ *                  ScatterUpdate
+ *                  /          \
+ *              Assign        Relu
+ *                              |
+ *                            Result
+ */
+// The cache of the keys/values with the reserved capacity: the beams are reordered and the new row is written
+// at the current position in place, in the state buffer of the infer request.
+
+namespace {
+constexpr size_t beams = 4, heads = 2, capacity = 16, headSize = 8;
+
+std::shared_ptr<ov::Model> makeKVCache() {
+    const ov::Shape cacheShape{beams, heads, capacity, headSize};
+    auto beamIdx = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::Shape{beams});
+    auto position = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::Shape{1});
+    auto newKV = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{beams, heads, 1, headSize});
+
+    auto init = ov::opset8::Constant::create(ov::element::f32, cacheShape, {0.0f});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape(cacheShape), ov::element::f32, "kv_cache"});
+    auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto gather = std::make_shared<ov::opset8::Gather>(readValue, beamIdx,
+                                                       ov::opset8::Constant::create(ov::element::i32, {}, {0}));
+    auto scatter = std::make_shared<ov::opset8::ScatterUpdate>(gather, position, newKV,
+                                                               ov::opset8::Constant::create(ov::element::i32, {}, {2}));
+    auto assign = std::make_shared<ov::opset8::Assign>(scatter, variable);
+    auto relu = std::make_shared<ov::opset8::Relu>(scatter);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                       ov::ParameterVector{beamIdx, position, newKV}, "KVCache");
+}
+} // namespace
+
+TEST(KVCacheStateTest, smoke_ReorderAndAppendInPlace_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeKVCache(), CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+
+    const size_t rowSize = heads * capacity * headSize;
+    std::vector<float> reference(beams * rowSize, 0.0f);
+    const std::vector<std::vector<int32_t>> beamIndices = {
+        {0, 1, 2, 3}, {0, 0, 1, 2}, {3, 2, 1, 0}, {1, 1, 1, 1}, {0, 1, 3, 3}, {2, 0, 3, 1}};
+
+    ov::Tensor beamIdx(ov::element::i32, {beams});
+    ov::Tensor position(ov::element::i32, {1});
+    ov::Tensor newKV(ov::element::f32, {beams, heads, 1, headSize});
+    for (size_t step = 0; step < beamIndices.size(); step++) {
+        std::copy(beamIndices[step].begin(), beamIndices[step].end(), beamIdx.data<int32_t>());
+        position.data<int32_t>()[0] = static_cast<int32_t>(step);
+        auto newData = newKV.data<float>();
+        for (size_t i = 0; i < newKV.get_size(); i++) {
+            newData[i] = static_cast<float>(step * 1000 + i + 1);
+        }
+        request.set_tensor(compiledModel.input(0), beamIdx);
+        request.set_tensor(compiledModel.input(1), position);
+        request.set_tensor(compiledModel.input(2), newKV);
+        request.infer();
+
+        // reference: reorder the beams, then write the new row at the position
+        std::vector<float> reordered(reference.size());
+        for (size_t b = 0; b < beams; b++) {
+            std::copy_n(reference.begin() + beamIndices[step][b] * rowSize, rowSize, reordered.begin() + b * rowSize);
+        }
+        for (size_t b = 0; b < beams; b++) {
+            for (size_t h = 0; h < heads; h++) {
+                std::copy_n(newData + (b * heads + h) * headSize, headSize,
+                            reordered.begin() + ((b * heads + h) * capacity + step) * headSize);
+            }
+        }
+        reference = reordered;
+
+        const auto output = request.get_output_tensor();
+        const float* outData = output.data<float>();
+        ASSERT_EQ(output.get_size(), reference.size());
+        for (size_t i = 0; i < reference.size(); i++) {
+            ASSERT_EQ(outData[i], reference[i]) << "step: " << step << " index: " << i;
+        }
+        const auto state = request.query_state().front().get_state();
+        const float* stateData = state.data<float>();
+        for (size_t i = 0; i < reference.size(); i++) {
+            ASSERT_EQ(stateData[i], reference[i]) << "step: " << step << " index: " << i;
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
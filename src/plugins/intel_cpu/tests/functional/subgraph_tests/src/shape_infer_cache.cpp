@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/common_utils.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *        Parameter
+ *         |     \
+ *         |   Transpose
+ *          \    /
+ *          MatMul
+ *            |
+ *         Softmax
+ *            |
+ *         Reshape
+ *            |
+ *          Result
+ */
+// The input shapes alternate, so the output shapes of the nodes are taken from the shape inference cache
+// for the recurring input shapes.
+
+class ShapeInferCacheSubgraphTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // a single graph, so the cache lookups of every inference are counted
+        configuration.insert(ov::num_streams(1));
+
+        const auto precision = ov::element::f32;
+        InputShape inputShape{{-1, 16, -1}, {{1, 16, 10}, {2, 16, 20}, {1, 16, 10}, {2, 16, 20}, {1, 16, 10}, {1, 16, 7}}};
+        init_input_shapes({inputShape});
+
+        auto params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+        auto order = ov::op::v0::Constant::create(ov::element::i32, {3}, {0, 2, 1});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(params[0], order);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], transpose);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(matMul, 2);
+        auto pattern = ov::op::v0::Constant::create(ov::element::i32, {2}, {0, -1});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(softmax, pattern, true);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(reshape)};
+        function = std::make_shared<ov::Model>(results, params, "ShapeInferCache");
+    }
+};
+
+TEST_F(ShapeInferCacheSubgraphTest, smoke_ShapeInferCache_CPU) {
+    run();
+    auto stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+    // three distinct sets of the input shapes out of six
+    ASSERT_EQ(stat["SHAPE_INFER_MISSES"], 3u);
+    ASSERT_EQ(stat["SHAPE_INFER_HITS"], 3u);
+}
+
+// Subgraph:
+/*
+ *   Parameter   Parameter
+ *       |        |     |
+ *    Softmax  ShapeOf  |
+ *        \     /      |
+ *        Reshape      /
+ *            \       /
+ *               Add
+ *                |
+ *              Result
+ */
+// The target shape of Reshape is defined by the data of ShapeOf, so Reshape infers its shape on every inference,
+// while the output shapes of the rest of the nodes are still taken from the cache for the recurring input shapes.
+
+class ShapeInferCacheDataDependencySubgraphTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(1));
+
+        const auto precision = ov::element::f32;
+        InputShape dataShape{{-1, 16, -1}, {{1, 16, 10}, {2, 16, 20}, {1, 16, 10}, {2, 16, 20}, {1, 16, 10}, {1, 16, 7}}};
+        InputShape targetShape{{-1, -1}, {{16, 10}, {32, 20}, {16, 10}, {32, 20}, {16, 10}, {16, 7}}};
+        init_input_shapes({dataShape, targetShape});
+
+        auto params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(params[0], 2);
+        auto shapeOf = std::make_shared<ov::op::v3::ShapeOf>(params[1], ov::element::i32);
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(softmax, shapeOf, false);
+        auto add = std::make_shared<ov::op::v1::Add>(reshape, params[1]);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(add)};
+        function = std::make_shared<ov::Model>(results, params, "ShapeInferCacheDataDependency");
+    }
+};
+
+TEST_F(ShapeInferCacheDataDependencySubgraphTest, smoke_ShapeInferCache_CPU) {
+    run();
+    auto stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+    ASSERT_EQ(stat["SHAPE_INFER_MISSES"], 3u);
+    ASSERT_EQ(stat["SHAPE_INFER_HITS"], 3u);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ie_system_conf.h>
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  Parameter  Parameter     Parameter  Parameter
+ *        \    /    |              \    /    |
+ *         Add      |               Add      |
+ *          |       |                |       |
+ *         Relu     |               Relu     |
+ *            \     |                  \     |
+ *            Multiply                 Multiply
+ *               |                        |
+ *             Result                   Result
+ */
+// The branches are tokenized into the two Snippets with the same body, so the second one takes the kernel
+// generated for the first one from the runtime cache. Compared to the model with a single branch, the cache is
+// looked up once more and the lookup is a hit.
+
+class SnippetsKernelCacheSubgraphTest : public SubgraphBaseTest {
+protected:
+    static std::shared_ptr<ov::Model> makeModel(size_t branchesNum) {
+        const auto precision = ov::element::f32;
+        const std::vector<size_t> shape{1, 16, 8, 8};
+        auto params = ngraph::builder::makeParams(precision, std::vector<std::vector<size_t>>(branchesNum * 2, shape));
+        ov::ResultVector results;
+        for (size_t i = 0; i < branchesNum; i++) {
+            auto add = std::make_shared<ov::op::v1::Add>(params[2 * i], params[2 * i + 1]);
+            auto relu = std::make_shared<ov::op::v0::Relu>(add);
+            results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v1::Multiply>(relu, params[2 * i + 1])));
+        }
+        return std::make_shared<ov::Model>(results, params, "SnippetsKernelCache");
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(1));
+
+        function = makeModel(2);
+        std::vector<ov::Shape> shapes;
+        for (const auto& input : function->inputs()) {
+            shapes.push_back(input.get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(shapes));
+    }
+};
+
+TEST_F(SnippetsKernelCacheSubgraphTest, smoke_SnippetsKernelCache_CPU) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "Snippets are not generated without AVX2";
+    run();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Subgraph", 2);
+    auto stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+
+    auto singleModel = core->compile_model(makeModel(1), targetDevice, configuration);
+    CPUTestUtils::CheckNumberOfNodesWithType(singleModel, "Subgraph", 1);
+    auto singleStat = singleModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+
+    // the second Snippet doesn't generate its own kernel
+    ASSERT_EQ(stat["MISSES"], singleStat["MISSES"]);
+    ASSERT_EQ(stat["HITS"], singleStat["HITS"] + 1);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Constant   Parameter
+ *      |          |
+ *  ReadValue      |
+ *         \      /
+ *           Add
+ *         /     \
+ *     Assign    Relu
+ *                |
+ *              Result
+ */
+// The Add writes the new state value right into the state buffer of the infer request, which is read by the
+// ReadValue on the next inference, so the state must be accumulated correctly for each request independently.
+
+namespace {
+std::shared_ptr<ov::Model> makeAccumulator(const ov::Shape& shape) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0.0f});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape(shape), ov::element::f32, "accumulator"});
+    auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::opset8::Add>(readValue, param);
+    auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param},
+                                       "Accumulator");
+}
+
+void fill(ov::Tensor& tensor, float value) {
+    auto data = tensor.data<float>();
+    std::fill(data, data + tensor.get_size(), value);
+}
+
+void checkAll(const ov::Tensor& tensor, float expected) {
+    const float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        ASSERT_EQ(data[i], expected) << "index: " << i;
+    }
+}
+} // namespace
+
+TEST(StatefulPingPongTest, smoke_StateIsAccumulatedPerRequest_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const ov::Shape shape{1, 1024};
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeAccumulator(shape), CommonTestUtils::DEVICE_CPU);
+    auto request1 = compiledModel.create_infer_request();
+    auto request2 = compiledModel.create_infer_request();
+
+    ov::Tensor input(ov::element::f32, shape);
+    float expected1 = 0.0f, expected2 = 0.0f;
+    for (int i = 1; i <= 5; i++) {
+        fill(input, static_cast<float>(i));
+        request1.set_input_tensor(input);
+        request1.infer();
+        expected1 += i;
+        checkAll(request1.get_output_tensor(), expected1);
+
+        fill(input, 1.0f);
+        request2.set_input_tensor(input);
+        request2.infer();
+        expected2 += 1.0f;
+        checkAll(request2.get_output_tensor(), expected2);
+    }
+
+    auto states = request1.query_state();
+    ASSERT_EQ(states.size(), 1u);
+    checkAll(states.front().get_state(), expected1);
+
+    // the returned state isn't one of the buffers written by the following inferences
+    auto snapshot = states.front().get_state();
+    request1.infer();
+    request1.infer();
+    checkAll(snapshot, expected1);
+    checkAll(states.front().get_state(), expected1 + 2.0f);
+
+    // the state set by the user is read by the next inference
+    ov::Tensor newState(ov::element::f32, shape);
+    fill(newState, 100.0f);
+    states.front().set_state(newState);
+    fill(input, 1.0f);
+    request1.set_input_tensor(input);
+    request1.infer();
+    checkAll(request1.get_output_tensor(), 101.0f);
+    checkAll(request1.query_state().front().get_state(), 101.0f);
+
+    states.front().reset();
+    request1.infer();
+    checkAll(request1.get_output_tensor(), 1.0f);
+
+    // the other request isn't affected
+    checkAll(request2.query_state().front().get_state(), expected2);
+}
+
+} // namespace SubgraphTestsDefinitions
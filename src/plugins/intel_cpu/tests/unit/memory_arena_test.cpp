@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "memory_arena.h"
+
+using namespace ov::intel_cpu;
+
+TEST(MemoryArenaTest, SizeClass) {
+    ASSERT_EQ(MemoryArena::sizeClass(0), 0u);
+    ASSERT_EQ(MemoryArena::sizeClass(1), 64u);
+    ASSERT_EQ(MemoryArena::sizeClass(64), 64u);
+    ASSERT_EQ(MemoryArena::sizeClass(1000), 1024u);
+    ASSERT_EQ(MemoryArena::sizeClass(1025), 1280u);
+    ASSERT_EQ(MemoryArena::sizeClass(4096), 4096u);
+    ASSERT_EQ(MemoryArena::sizeClass(4097), 5120u);
+    for (size_t size = 1; size < (1 << 20); size = size * 3 / 2 + 1) {
+        const auto sizeClass = MemoryArena::sizeClass(size);
+        ASSERT_GE(sizeClass, size);
+        ASSERT_LE(sizeClass, size + size / 4 + 64);
+    }
+}
+
+TEST(MemoryArenaTest, ReallocationOnlyOnSizeClassGrowth) {
+    auto arena = std::make_shared<MemoryArena>();
+    MemoryMngrWithArena mngr(arena);
+
+    ASSERT_TRUE(mngr.resize(5000));
+    ASSERT_NE(mngr.getRawPtr(), nullptr);
+    std::memset(mngr.getRawPtr(), 0, 5000);
+    // the same size class
+    ASSERT_FALSE(mngr.resize(5100));
+    ASSERT_FALSE(mngr.resize(100));
+    ASSERT_TRUE(mngr.resize(10000));
+    std::memset(mngr.getRawPtr(), 0, 10000);
+
+    const auto stat = arena->getStatistics();
+    ASSERT_EQ(stat.allocations, 2u);
+    ASSERT_EQ(stat.reallocations, 1u);
+    ASSERT_EQ(stat.reuses, 0u);
+}
+
+TEST(MemoryArenaTest, ReleasedBlocksAreReused) {
+    auto arena = std::make_shared<MemoryArena>();
+    void* firstPtr = nullptr;
+    {
+        MemoryMngrWithArena first(arena);
+        first.resize(20000);
+        firstPtr = first.getRawPtr();
+        MemoryMngrWithArena second(arena);
+        second.resize(1000);
+    }
+    auto stat = arena->getStatistics();
+    ASSERT_EQ(stat.allocations, 2u);
+    ASSERT_EQ(stat.retainedBytes, MemoryArena::sizeClass(20000) + MemoryArena::sizeClass(1000));
+
+    // the retained block is taken, not a new one
+    MemoryMngrWithArena third(arena);
+    third.resize(19000);
+    ASSERT_EQ(third.getRawPtr(), firstPtr);
+    stat = arena->getStatistics();
+    ASSERT_EQ(stat.allocations, 2u);
+    ASSERT_EQ(stat.reuses, 1u);
+}
+
+TEST(MemoryArenaTest, FootprintIsLimitedByHighWatermark) {
+    auto arena = std::make_shared<MemoryArena>();
+    MemoryMngrWithArena mngr(arena);
+    // the shape grows step by step, the blocks of the previous size classes mustn't be accumulated
+    for (size_t size = 1024; size < (1 << 22); size *= 2) {
+        mngr.resize(size);
+        const auto stat = arena->getStatistics();
+        ASSERT_LE(stat.retainedBytes + MemoryArena::sizeClass(size), stat.peakBytes);
+    }
+}
+
+TEST(MemoryArenaTest, ExternalBuffer) {
+    auto arena = std::make_shared<MemoryArena>();
+    MemoryMngrWithArena mngr(arena);
+    mngr.resize(4096);
+    std::vector<char> buffer(8192);
+    mngr.setExtBuff(buffer.data(), buffer.size());
+    ASSERT_TRUE(mngr.hasExtBuffer());
+    ASSERT_EQ(mngr.getRawPtr(), buffer.data());
+    ASSERT_FALSE(mngr.resize(8000));
+    // the own block is returned to the arena
+    ASSERT_EQ(arena->getStatistics().retainedBytes, 4096u);
+    ASSERT_TRUE(mngr.resize(10000));
+    ASSERT_FALSE(mngr.hasExtBuffer());
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <ngraph_transformations/op/fused_preprocess.hpp>
+#include <ngraph_transformations/fuse_preprocessing.hpp>
+#include <transformations/init_node_info.hpp>
+
+using namespace testing;
+using namespace ov::intel_cpu;
+using namespace ov;
+
+namespace {
+
+std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape, const ov::Layout& layout) {
+    auto input = std::make_shared<opset8::Parameter>(element::f32, shape);
+    input->set_layout(layout);
+    auto relu = std::make_shared<opset8::Relu>(input);
+    return std::make_shared<ov::Model>(relu, ParameterVector{input}, "preprocessing");
+}
+
+void runFusion(const std::shared_ptr<ov::Model>& model) {
+    pass::Manager m;
+    m.register_pass<ov::pass::InitNodeInfo>();
+    m.register_pass<FusePreprocessing>();
+    m.run_passes(model);
+}
+
+template <typename T>
+size_t countNodes(const std::shared_ptr<ov::Model>& model) {
+    const auto ops = model->get_ops();
+    return std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& node) {
+        return ov::is_type<T>(node);
+    });
+}
+
+std::shared_ptr<FusedPreprocessNode> getFused(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& node : model->get_ops()) {
+        if (const auto fused = ov::as_type_ptr<FusedPreprocessNode>(node))
+            return fused;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(TransformationTests, FusePreprocessingNV12ResizeMeanScaleLayout) {
+    auto model = makeModel({1, 3, 224, 224}, "NCHW");
+    {
+        using namespace ov::preprocess;
+        PrePostProcessor p(model);
+        p.input().tensor().set_element_type(element::u8)
+                          .set_color_format(ColorFormat::NV12_TWO_PLANES)
+                          .set_spatial_static_shape(480, 640);
+        p.input().preprocess().convert_element_type(element::f32)
+                              .convert_color(ColorFormat::BGR)
+                              .resize(ResizeAlgorithm::RESIZE_LINEAR)
+                              .mean({1.f, 2.f, 3.f})
+                              .scale({2.f, 4.f, 8.f});
+        p.input().model().set_layout("NCHW");
+        model = p.build();
+    }
+    runFusion(model);
+
+    ASSERT_EQ(countNodes<FusedPreprocessNode>(model), 1u);
+    EXPECT_EQ(countNodes<opset8::NV12toBGR>(model), 0u);
+    EXPECT_EQ(countNodes<opset8::Interpolate>(model), 0u);
+    EXPECT_EQ(countNodes<opset8::Transpose>(model), 0u);
+
+    const auto fused = getFused(model);
+    ASSERT_EQ(fused->get_input_size(), 2u);
+    EXPECT_EQ(fused->get_input_element_type(0), element::u8);
+    EXPECT_TRUE(ov::is_type<opset8::Parameter>(fused->get_input_node_shared_ptr(0)));
+    EXPECT_TRUE(ov::is_type<opset8::Parameter>(fused->get_input_node_shared_ptr(1)));
+    EXPECT_EQ(fused->get_output_shape(0), (ov::Shape{1, 3, 224, 224}));
+
+    const auto& attrs = fused->get_attrs();
+    EXPECT_FALSE(attrs.i420);
+    EXPECT_TRUE(attrs.bgr);
+    EXPECT_FALSE(attrs.round_rgb);
+    EXPECT_TRUE(attrs.planar);
+    EXPECT_EQ(attrs.output_size, (std::vector<int64_t>{224, 224}));
+    EXPECT_EQ(attrs.scale, (std::vector<float>{0.5f, 0.25f, 0.125f}));
+    EXPECT_EQ(attrs.shift, (std::vector<float>{-0.5f, -0.5f, -0.375f}));
+}
+
+TEST(TransformationTests, FusePreprocessingI420RoundedColorConversion) {
+    auto model = makeModel({1, 480, 640, 3}, "NHWC");
+    {
+        using namespace ov::preprocess;
+        PrePostProcessor p(model);
+        p.input().tensor().set_element_type(element::u8)
+                          .set_color_format(ColorFormat::I420_SINGLE_PLANE);
+        p.input().preprocess().convert_color(ColorFormat::RGB)
+                              .convert_element_type(element::f32);
+        model = p.build();
+    }
+    runFusion(model);
+
+    ASSERT_EQ(countNodes<FusedPreprocessNode>(model), 1u);
+    EXPECT_EQ(countNodes<opset8::Convert>(model), 0u);
+
+    const auto& attrs = getFused(model)->get_attrs();
+    EXPECT_TRUE(attrs.i420);
+    EXPECT_FALSE(attrs.bgr);
+    EXPECT_TRUE(attrs.round_rgb);
+    EXPECT_FALSE(attrs.planar);
+    EXPECT_TRUE(attrs.output_size.empty());
+    EXPECT_EQ(attrs.scale, (std::vector<float>{1.f, 1.f, 1.f}));
+    EXPECT_EQ(attrs.shift, (std::vector<float>{0.f, 0.f, 0.f}));
+}
+
+TEST(TransformationTests, FusePreprocessingStopsOnUnsupportedResize) {
+    auto model = makeModel({1, 3, 224, 224}, "NCHW");
+    {
+        using namespace ov::preprocess;
+        PrePostProcessor p(model);
+        p.input().tensor().set_element_type(element::u8)
+                          .set_color_format(ColorFormat::NV12_SINGLE_PLANE)
+                          .set_spatial_static_shape(480, 640);
+        p.input().preprocess().convert_element_type(element::f32)
+                              .convert_color(ColorFormat::RGB)
+                              .resize(ResizeAlgorithm::RESIZE_NEAREST);
+        p.input().model().set_layout("NCHW");
+        model = p.build();
+    }
+    runFusion(model);
+
+    ASSERT_EQ(countNodes<FusedPreprocessNode>(model), 0u);
+    EXPECT_EQ(countNodes<opset8::NV12toRGB>(model), 1u);
+    EXPECT_EQ(countNodes<opset8::Interpolate>(model), 1u);
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/opsets/opset8.hpp"
+#include "graph.h"
+#include "graph_context.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// The cache of the keys/values with the reserved capacity: ReadValue -> Gather (beam reorder) -> ScatterUpdate
+// (the new row at the position) -> Assign. The values are checked by the KVCacheStateTest functional test.
+std::shared_ptr<ov::Model> makeKVCache() {
+    const ov::Shape cacheShape{4, 2, 16, 8};
+    auto beamIdx = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::Shape{4});
+    auto position = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::Shape{1});
+    auto newKV = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 2, 1, 8});
+
+    auto init = ov::opset8::Constant::create(ov::element::f32, cacheShape, {0.0f});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape(cacheShape), ov::element::f32, "kv_cache"});
+    auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto gather = std::make_shared<ov::opset8::Gather>(readValue, beamIdx,
+                                                       ov::opset8::Constant::create(ov::element::i32, {}, {0}));
+    auto scatter = std::make_shared<ov::opset8::ScatterUpdate>(gather, position, newKV,
+                                                               ov::opset8::Constant::create(ov::element::i32, {}, {2}));
+    auto assign = std::make_shared<ov::opset8::Assign>(scatter, variable);
+    auto relu = std::make_shared<ov::opset8::Relu>(scatter);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                       ov::ParameterVector{beamIdx, position, newKV}, "KVCache");
+}
+
+NodePtr findNode(const Graph& graph, Type type) {
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() == type)
+            return node;
+    }
+    return nullptr;
+}
+} // namespace
+
+// The beam reorder and the update are executed in place: the whole chain from the ReadValue to the Assign works
+// with the same memory, so the state is updated in its own buffer with no copy and no buffer swap.
+TEST(KVCacheInPlaceTest, StateIsUpdatedInPlace) {
+    Config conf;
+    conf.rtCacheCapacity = 100;
+    conf.enforceBF16 = false;
+    auto context = std::make_shared<GraphContext>(conf,
+                                                  nullptr,
+                                                  std::make_shared<WeightsSharing>(),
+                                                  std::make_shared<std::mutex>(),
+                                                  false);
+    const std::shared_ptr<const ov::Model> model = makeKVCache();
+    Graph graph;
+    graph.CreateGraph(model, context);
+
+    const auto readValue = findNode(graph, Type::MemoryInput);
+    const auto gather = findNode(graph, Type::Gather);
+    const auto scatter = findNode(graph, Type::ScatterUpdate);
+    const auto assign = findNode(graph, Type::MemoryOutput);
+    ASSERT_TRUE(readValue && gather && scatter && assign);
+
+    const auto stateData = readValue->getChildEdgeAt(0)->getMemory().GetData();
+    ASSERT_EQ(gather->getChildEdgeAt(0)->getMemory().GetData(), stateData) << "Gather is not executed in place";
+    ASSERT_EQ(scatter->getParentEdgeAt(0)->getMemory().GetData(), stateData);
+    ASSERT_EQ(scatter->getChildEdgeAt(0)->getMemory().GetData(), stateData) << "ScatterUpdate is not executed in place";
+    ASSERT_EQ(assign->getParentEdgeAt(0)->getMemory().GetData(), stateData);
+}
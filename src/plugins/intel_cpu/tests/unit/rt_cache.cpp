@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -96,6 +98,69 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, PutReportsEviction) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_FALSE(cache.put({i}, i));
+    }
+    // updating the existing record doesn't evict anything
+    ASSERT_FALSE(cache.put({0}, 0));
+    ASSERT_TRUE(cache.put({capacity}, capacity));
+}
+
+TEST(ShardedLruCacheTests, SingleShardIsLru) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_FALSE(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ShardedLruCacheTests, Shards) {
+    constexpr size_t capacity = 16;
+    constexpr size_t shards = 4;
+    ShardedLruCache<IntKey, int> cache(capacity, shards);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+    for (int i = 1; i <= 3 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+        // the most recently used record is never evicted
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    size_t records = 0;
+    for (int i = 1; i <= 3 * capacity; ++i) {
+        if (cache.get({i}) == i)
+            records++;
+    }
+    ASSERT_LE(records, capacity);
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_FALSE(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +444,65 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits, capacity);
+    ASSERT_EQ(stat.misses, 3 * capacity);
+    ASSERT_EQ(stat.evictions, capacity);
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 1000;
+    constexpr size_t numKeys = 100;
+    constexpr size_t numThreads = 16;
+    constexpr size_t numIterations = 1000;
+
+    std::atomic<size_t> builds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        builds++;
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity, numThreads);
+
+    auto testRoutine = [&]() {
+        for (size_t iter = 0; iter < numIterations; ++iter) {
+            const int i = static_cast<int>(iter % numKeys);
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits + stat.misses, numThreads * numIterations);
+    ASSERT_EQ(stat.misses, builds.load());
+    ASSERT_EQ(stat.evictions, 0u);
+    // concurrent misses may build the same value several times, but the most of the lookups must hit
+    ASSERT_GT(stat.hits, stat.misses);
+}
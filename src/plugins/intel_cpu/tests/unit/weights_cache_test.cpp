@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<unsigned char> makeData(size_t size) {
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<unsigned char>((i * 131) ^ (i >> 8));
+    }
+    return data;
+}
+
+uint64_t hash(const std::vector<unsigned char>& data, size_t offset = 0) {
+    return WeightsSharing::GetHashFunc().hash(data.data() + offset, data.size() - offset);
+}
+
+// the sizes around the block, the tail and the chunk boundaries
+const std::vector<size_t> sizes = {0, 1, 3, 4, 7, 8, 31, 32, 33, 100, 4096,
+                                   DataHash::kChunkSize - 1, DataHash::kChunkSize, DataHash::kChunkSize + 1,
+                                   3 * DataHash::kChunkSize + 17};
+} // namespace
+
+TEST(DataHashTests, ReferenceValue) {
+    // XXH64 of the empty input with the zero seed
+    ASSERT_EQ(WeightsSharing::GetHashFunc().hash(nullptr, 0), 0xEF46DB3751D8E999ull);
+}
+
+TEST(DataHashTests, SameContentSameHash) {
+    for (auto size : sizes) {
+        const auto data = makeData(size);
+        // the copy with another alignment
+        std::vector<unsigned char> shifted(size + 3);
+        std::copy(data.begin(), data.end(), shifted.begin() + 3);
+
+        ASSERT_EQ(hash(data), hash(data)) << "size: " << size;
+        ASSERT_EQ(hash(data), hash(shifted, 3)) << "size: " << size;
+    }
+}
+
+TEST(DataHashTests, DifferentContentDifferentHash) {
+    for (auto size : sizes) {
+        if (size == 0)
+            continue;
+        const auto data = makeData(size);
+        const auto reference = hash(data);
+        // any byte change must be detected, including the ones in the tail and in the last chunk
+        for (auto pos : {size_t(0), size / 2, size - 1}) {
+            auto modified = data;
+            modified[pos] ^= 1;
+            ASSERT_NE(reference, hash(modified)) << "size: " << size << " pos: " << pos;
+        }
+        // the size is a part of the hash
+        auto extended = data;
+        extended.push_back(0);
+        ASSERT_NE(reference, hash(extended)) << "size: " << size;
+    }
+}
+
+TEST(WeightsSharingTests, SharingByContentHash) {
+    WeightsSharing weightsCache;
+    auto engine = dnnl::engine(dnnl::engine::kind::cpu, 0);
+    size_t created = 0;
+    auto create = [&]() {
+        created++;
+        return std::make_shared<Memory>(engine);
+    };
+    auto key = [](const std::vector<unsigned char>& data) {
+        return "node_0_" + std::to_string(data.size()) + "_" + std::to_string(hash(data));
+    };
+
+    for (auto size : {size_t(64), 2 * DataHash::kChunkSize + 5}) {
+        const auto data = makeData(size);
+        const auto copy = data;
+        auto modified = data;
+        modified.back() ^= 1;
+
+        created = 0;
+        MemoryPtr first = *weightsCache.findOrCreate(key(data), create);
+        MemoryPtr second = *weightsCache.findOrCreate(key(copy), create);
+        MemoryPtr third = *weightsCache.findOrCreate(key(modified), create);
+        // identical content is shared regardless of the buffer address, modified content is not
+        ASSERT_EQ(created, 2u) << "size: " << size;
+        ASSERT_EQ(first, second);
+        ASSERT_NE(first, third);
+    }
+}
@@ -37,6 +37,8 @@ void AsyncInferRequest::StartAsync_ThreadUnsafe() {
     if (_inferRequest->use_external_queue()) {
         _inferRequest->setup_stream_graph();
         _inferRequest->enqueue_notify();
+        // the device already executes the request, the wait stage must not be skipped by the deadline
+        SetExecutionStarted();
     }
     Parent::StartAsync_ThreadUnsafe();
 }
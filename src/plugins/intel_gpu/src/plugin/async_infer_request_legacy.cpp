@@ -39,6 +39,8 @@ void AsyncInferRequestLegacy::StartAsync_ThreadUnsafe() {
         _inferRequest->setup_stream_graph();
         _inferRequest->preprocess_notify();
         _inferRequest->enqueue_notify();
+        // the device already executes the request, the wait stage must not be skipped by the deadline
+        SetExecutionStarted();
     }
     Parent::StartAsync_ThreadUnsafe();
 }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <string>
 #include <utility>
 #include <vector>
@@ -50,6 +51,10 @@ protected:
     size_t num_requests;
     size_t num_batch;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
+    // minimize timeout to reduce test time
+    unsigned int timeout_ms = 1;
+    bool partial_batches = false;
+    std::chrono::steady_clock::duration infer_time{};
 
     void TestAutoBatch() {
         std::vector<InferenceEngine::CNNNetwork> nets;
@@ -79,8 +84,9 @@ protected:
                 config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
                 config[CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(NO);
             }
-            // minimize timeout to reduce test time
-            config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(timeout_ms);
+            if (partial_batches)
+                config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(YES);
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     target_device + "(" + std::to_string(num_batch) + ")",
                                                config);
@@ -122,6 +128,7 @@ protected:
         }
 
         const int niter = 1;
+        const auto start = std::chrono::steady_clock::now();
         for (int i = 0; i < niter; i++) {
             for (auto ir : irs) {
                 ir.StartAsync();
@@ -131,6 +138,7 @@ protected:
                 ir.Wait(InferRequest::RESULT_READY);
             }
         }
+        infer_time = std::chrono::steady_clock::now() - start;
 
         auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
         for (size_t i = 0; i < irs.size(); ++i) {
@@ -163,6 +171,22 @@ public:
     }
 };
 
+// the number of requests is not a multiple of the batch size, so the rest is executed as the smaller batches
+class AutoBatching_Test_PartialBatch : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(target_device, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        timeout_ms = 1000;
+        partial_batches = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "PartialBatch_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -171,4 +195,11 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatch, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+    // the requests don't wait for the whole timeout when the batch is not expected to be filled
+    // (at least two requests per batch are needed to estimate the arrival rate)
+    EXPECT_LT(infer_time, std::chrono::milliseconds(timeout_ms));
+}
+
 }  // namespace AutoBatchingTests
@@ -200,4 +200,31 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "2";
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    // more requests in flight than the subgraph pools have, the rest wait for free subgraph requests
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < 5; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            requests.back().SetBlob(input.first, inferRequest.GetBlob(input.first));
+        }
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(inferRequest.GetBlob(output.first), request.GetBlob(output.first));
+        }
+    }
+}
+
 }  //  namespace HeteroTests
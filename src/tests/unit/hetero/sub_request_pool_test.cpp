@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "infer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class SubRequestPoolTests : public ::testing::Test {
+protected:
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> mockNetwork;
+    std::vector<std::shared_ptr<NiceMock<MockIInferRequestInternal>>> mockRequests;
+
+    void SetUp() override {
+        mockNetwork = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        ON_CALL(*mockNetwork, CreateInferRequest()).WillByDefault([this]() {
+            mockRequests.push_back(std::make_shared<NiceMock<MockIInferRequestInternal>>());
+            return mockRequests.back();
+        });
+    }
+
+    SubRequestPool::Ptr createPool(std::size_t depth, bool perfCount = false) {
+        return std::make_shared<SubRequestPool>(SoExecutableNetworkInternal{mockNetwork, {}}, depth, perfCount);
+    }
+};
+
+TEST_F(SubRequestPoolTests, acquireWaitsForReleaseWhenAllRequestsAreInFlight) {
+    auto pool = createPool(2);
+    std::vector<SoIInferRequestInternal> acquired;
+    for (int i = 0; i < 3; ++i) {
+        pool->Acquire([&](const SoIInferRequestInternal& request) {
+            acquired.push_back(request);
+        });
+    }
+    ASSERT_EQ(2u, acquired.size());
+    EXPECT_NE(acquired[0]._ptr, acquired[1]._ptr);
+
+    pool->Release(acquired[0]);
+    ASSERT_EQ(3u, acquired.size());
+    EXPECT_EQ(acquired[0]._ptr, acquired[2]._ptr);
+}
+
+TEST_F(SubRequestPoolTests, waitersAreServedInOrderOfArrival) {
+    auto pool = createPool(1);
+    auto request = pool->Acquire();
+    std::vector<int> order;
+    for (int i = 0; i < 3; ++i) {
+        pool->Acquire([&, i](const SoIInferRequestInternal&) {
+            order.push_back(i);
+        });
+    }
+    EXPECT_TRUE(order.empty());
+    for (int i = 0; i < 3; ++i) {
+        pool->Release(request);
+    }
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), order);
+}
+
+TEST_F(SubRequestPoolTests, blockingAcquireWaitsForRelease) {
+    auto pool = createPool(1);
+    auto request = pool->Acquire();
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&] {
+        pool->Acquire();
+        acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(acquired);
+    pool->Release(request);
+    waiter.join();
+    EXPECT_TRUE(acquired);
+}
+
+TEST_F(SubRequestPoolTests, perfCountsAreReadBeforeRequestIsReleased) {
+    auto inputData = std::make_shared<Data>("in", TensorDesc(Precision::FP32, {1}, Layout::C));
+    auto outputData = std::make_shared<Data>("out", TensorDesc(Precision::FP32, {1}, Layout::C));
+    auto inputInfo = std::make_shared<InputInfo>();
+    inputInfo->setInputData(inputData);
+    ON_CALL(*mockNetwork, GetInputsInfo()).WillByDefault(Return(ConstInputsDataMap{{"in", inputInfo}}));
+    ON_CALL(*mockNetwork, GetOutputsInfo()).WillByDefault(Return(ConstOutputsDataMap{{"out", outputData}}));
+
+    HeteroInferRequest::SubRequestDesc desc;
+    desc._network = {mockNetwork, {}};
+    desc._pool = createPool(1, true);
+    HeteroInferRequest inferRequest(InputsDataMap{{"in", inputInfo}},
+                                    OutputsDataMap{{"out", outputData}},
+                                    {desc},
+                                    {});
+    ASSERT_TRUE(inferRequest.IsPipelined());
+
+    // the released request is reused by another infer request which overwrites its counters
+    InferenceEngineProfileInfo info = {};
+    info.status = InferenceEngineProfileInfo::EXECUTED;
+    EXPECT_CALL(*mockRequests.front(), GetPerformanceCounts())
+        .WillOnce(Return(std::map<std::string, InferenceEngineProfileInfo>{{"own", info}}))
+        .WillRepeatedly(Return(std::map<std::string, InferenceEngineProfileInfo>{{"other", info}}));
+
+    inferRequest.BindSubRequest(0, desc._pool->Acquire());
+    inferRequest.ReleaseSubRequests(0);
+    auto perfCounts = inferRequest.GetPerformanceCounts();
+    ASSERT_EQ(1u, perfCounts.size());
+    EXPECT_EQ("subgraph0: own", perfCounts.begin()->first);
+}